@@ -9,6 +9,24 @@
   - controls.h: Button and joystick handling  
   - radio.h: NRF24 communication
   - config.h: Pin definitions and constants
+  - curves.h: Expo, dual-rate and multi-point curve lookup tables
+  - input_events.h: Button debounce, long-press/auto-repeat and event queue
+  - mixer.h: Q15 mixer matrix (direct, tank and elevon presets)
+  - channel_frame.h: Packed 8 x 11-bit channel frame encoder/decoder (USE_CHANNEL_FRAME)
+  - deadzone.h: Per-axis rescaled deadzone with centre hysteresis
+  - trims.h: Digital trims with per-model storage and deferred EEPROM writes
+  - slew.h: Per-channel slew-rate limiter (throttle ramp)
+  - axes.h: Analog axis descriptor table (pin, calibration slot, labels, inversion)
+  - stats.h: Welford running statistics (mean, std-dev, min/max)
+  - latency_probe.h: Input-snapshot to radio hand-off latency histogram (USE_LATENCY_PROBE)
+  - logic_switches.h: Switch channels and logic switches L1-L6 (compiled to bytecode, run per TX tick)
+  - display_flush.h: Non-blocking SSD1306 flush of changed column spans, one I2C transaction per call
+  - display_numbers.h: Right-aligned fixed-width numbers written directly into the SSD1306 page buffer
+  - menu_tree.h: Declarative menu tree - item tables and one node per MenuState
+  - heap_counter.h: malloc/realloc counter and allocations per menu frame (USE_HEAP_COUNTER)
+  - display_dump.h: Boot-time PBM dump, render time and CRC32 of every static screen (USE_SCREEN_DUMP)
+  - tests/: Host tests (make -C tests) - channel frame round trip, and every screen rendered
+    against the stub core in tests/host/ and compared with the golden images in tests/golden/
   
   Features:
   - Hold OK button for 2 seconds to enter menu
@@ -29,11 +47,13 @@
 #include "menu.h"
 #include "radio_test.h" // Added for radio testing
 #include "audio.h"
+#include "display_dump.h"
 
 
 // Global variables
 RCData data;
-unsigned long lastTransmit = 0;
+uint32_t nextTransmitMicros = 0;   // Deadline of the next TX tick
+bool txSamplingOpen = false;       // Acquisition window for that tick has started
 unsigned long lastDisplayUpdate = 0;
 
 // LED update tracking to prevent excessive calls
@@ -111,6 +131,10 @@ void setup() {
   extern void applyLEDSettings();
   applyLEDSettings();
   
+#if USE_SCREEN_DUMP
+  dumpAllScreens();  // Every static screen to Serial as PBM + CRC32
+#endif
+  
   Serial.println("=====================================");
   Serial.println("Setup Complete! Ready to transmit.");
   Serial.println("Hold OK button for 2 seconds to enter menu");
@@ -125,23 +149,40 @@ void loop() {
   // Update menu system first (handles OK button long press and factory reset)
   updateMenu();
   updateAudio();
-  // Read controls (includes calibrated joystick values)
-  readJoysticks();
   
-  // Transmit data every 20ms (50Hz) - only if not in active calibration
-  if (millis() - lastTransmit >= TRANSMIT_INTERVAL) {
+  // Transmit data every 20ms (50Hz) on a fixed deadline. The sticks are
+  // sampled in the TX_SAMPLE_LEAD_US window just before it, so every frame
+  // carries an equally fresh sample.
+  int32_t untilTransmit = (int32_t)(nextTransmitMicros - micros());
+  if (untilTransmit <= TX_SAMPLE_LEAD_US) {
+    if (!txSamplingOpen) {
+      beginAxisSampling(nextTransmitMicros);
+      txSamplingOpen = true;
+    }
+    updateAxisSampling();
+  }
+  if (untilTransmit <= 0) {
+    // Average the window and run calibration, curves and mixer once per TX tick
+    readJoysticks();
     transmitData();
-    lastTransmit = millis();
+    txSamplingOpen = false;
+    
+    nextTransmitMicros += TRANSMIT_INTERVAL * 1000UL;
+    if ((int32_t)(micros() - nextTransmitMicros) >= 0) {
+      nextTransmitMicros = micros() + TRANSMIT_INTERVAL * 1000UL;  // Missed ticks are dropped, not burst
+    }
   }
   
-  // Update display every 50ms (20Hz)
-  if (millis() - lastDisplayUpdate >= DISPLAY_INTERVAL) {
+  // Update display every 50ms (20Hz) - the next frame renders while the previous one is still being sent
+  if (millis() - lastDisplayUpdate >= DISPLAY_INTERVAL && !isDisplayBusy()) {
     updateDisplay(); // Automatically switches between main and menu display
     lastDisplayUpdate = millis();
   }
+  serviceDisplay();  // Render slices and I2C transactions within DISPLAY_BUDGET_US
   
-  // Check buttons (includes arming system)
+  // Check buttons (includes arming system and trims)
   checkButtons();
+  updateTrims();  // Deferred trim write, one EEPROM byte per pass
   
   // Only update LEDs when state actually changes
   bool currentArmedState = getArmedStatus();
@@ -176,6 +217,13 @@ void printSystemStatus() {
   Serial.print("Throttle: "); Serial.print(data.throttle); 
   Serial.print(" Steering: "); Serial.println(data.steering);
   Serial.print("Packets sent: "); Serial.println(data.counter);
+  Serial.print("Input events dropped: "); Serial.print(getInputEventsDropped());
+  Serial.print(" Capture overflows: "); Serial.println(getButtonCaptureOverflows());
+  printDisplayFlushStats();
+  printDisplayBudgetStats();
+#if USE_HEAP_COUNTER
+  printHeapStats();
+#endif
   
   // LED status debug
   extern SettingsData settings;
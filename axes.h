@@ -0,0 +1,60 @@
+/*
+  axes.h - Analog Axis Descriptor Table
+  RC Transmitter for Teensy 4.0
+
+  One constexpr entry per analog input. Calibration, the calibration
+  status menus, the input test and the control pipeline all look axes up
+  here by AxisId instead of comparing name strings, so adding an axis is
+  one enum value plus one table entry.
+*/
+
+#ifndef AXES_H
+#define AXES_H
+
+#include "config.h"
+#include "deadzone.h"
+
+// Table order is also the slot order in CalibrationData (keeps the EEPROM layout)
+enum AxisId {
+  AXIS_RIGHT_X = 0,   // Steering
+  AXIS_RIGHT_Y,
+  AXIS_LEFT_X,
+  AXIS_LEFT_Y,        // Throttle
+  AXIS_LEFT_POT,
+  AXIS_RIGHT_POT,
+  NUM_AXES
+};
+
+enum AxisKind {
+  AXIS_KIND_STICK = 0,
+  AXIS_KIND_POT
+};
+
+struct AxisDescriptor {
+  uint8_t pin;            // Analog pin
+  uint8_t calSlot;        // Index into calData.axes[] / calData.calibrated[]
+  const char* label;      // Menu label
+  const char* shortLabel; // Two-letter label for dense screens
+  bool inverted;          // Uncalibrated mapping runs +1000 at 0 counts
+  uint8_t kind;           // AxisKind
+  int8_t deadzoneAxis;    // DeadzoneAxis, -1 = no deadzone stage
+};
+
+constexpr AxisDescriptor axisTable[NUM_AXES] = {
+  {RIGHT_JOY_X, 0, "Right X",   "RX", true,  AXIS_KIND_STICK, DZ_STEERING},
+  {RIGHT_JOY_Y, 1, "Right Y",   "RY", false, AXIS_KIND_STICK, DZ_RIGHT_Y},
+  {LEFT_JOY_X,  2, "Left X",    "LX", false, AXIS_KIND_STICK, DZ_LEFT_X},
+  {LEFT_JOY_Y,  3, "Left Y",    "LY", false, AXIS_KIND_STICK, DZ_THROTTLE},
+  {LEFT_POT,    4, "Left Pot",  "LP", false, AXIS_KIND_POT,   -1},
+  {RIGHT_POT,   5, "Right Pot", "RP", false, AXIS_KIND_POT,   -1},
+};
+
+static_assert(sizeof(axisTable) / sizeof(axisTable[0]) == NUM_AXES, "One descriptor per AxisId");
+
+// Number of stick axes - sticks come first in the table
+constexpr int countStickAxes(int i = 0) {
+  return (i < NUM_AXES && axisTable[i].kind == AXIS_KIND_STICK) ? 1 + countStickAxes(i + 1) : 0;
+}
+#define NUM_STICK_AXES countStickAxes()
+
+#endif
@@ -0,0 +1,132 @@
+/*
+  channel_frame.h - Packed Multi-Channel Control Frame
+  RC Transmitter for Teensy 4.0
+
+  8 channels x 11 bits plus a switch bitfield, counter and the range
+  configuration in one 29 byte nRF24 payload. Channels carry -1000..+1000
+  offset by 1024, so the packing is lossless. All multi-byte fields are
+  little-endian and the file only depends on <stdint.h>/<string.h>, so the
+  receiver (or any host tool) can include it as-is for decoding.
+*/
+
+#ifndef CHANNEL_FRAME_H
+#define CHANNEL_FRAME_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define CHANNEL_FRAME_TYPE 0xC8          // First byte - distinguishes from the legacy RCData
+#define CHANNEL_FRAME_CHANNELS 8
+#define CHANNEL_FRAME_BITS 11
+#define CHANNEL_FRAME_CENTER 1024
+#define CHANNEL_FRAME_PACKED_BYTES ((CHANNEL_FRAME_CHANNELS * CHANNEL_FRAME_BITS + 7) / 8)  // 11
+#define CHANNEL_FRAME_SIZE (1 + CHANNEL_FRAME_PACKED_BYTES + 2 + 4 + 5 * 2 + 1)           // 29
+
+static_assert(CHANNEL_FRAME_SIZE <= 32, "Channel frame must fit one nRF24 payload");
+
+// Switch bitfield layout
+#define SWITCH_LEFT_TRIGGER_SHIFT 0      // 2 bits: 0 = middle, 1 = up, 2 = down
+#define SWITCH_RIGHT_TRIGGER_SHIFT 2     // 2 bits: 0 = middle, 1 = up, 2 = down
+#define SWITCH_LEFT_JOY_BTN (1 << 4)
+#define SWITCH_RIGHT_JOY_BTN (1 << 5)
+#define SWITCH_ARMED (1 << 6)
+#define SWITCH_LOW_RATE (1 << 7)
+#define SWITCH_LOGIC_SHIFT 8             // 6 bits: logic switches L1-L6 (sent armed or disarmed)
+
+// Unpacked frame contents
+struct ChannelFrame {
+  int16_t channels[CHANNEL_FRAME_CHANNELS];  // -1000 to +1000
+  uint16_t switches;                         // SWITCH_* bits
+  uint32_t counter;                          // Packet counter
+
+  // Range configuration data (same meaning as in RCData)
+  int16_t throttleMinPWM;
+  int16_t throttleMaxPWM;
+  int16_t steerMinDegree;
+  int16_t steerNeutralDegree;
+  int16_t steerMaxDegree;
+  uint8_t configChanged;
+};
+
+// Function declarations
+void encodeChannelFrame(const ChannelFrame& frame, uint8_t* buffer);
+bool decodeChannelFrame(const uint8_t* buffer, int length, ChannelFrame& frame);
+void packChannels(const int16_t* channels, uint8_t* packed);
+void unpackChannels(const uint8_t* packed, int16_t* channels);
+void putFrameU16(uint8_t* buffer, uint16_t value);
+uint16_t getFrameU16(const uint8_t* buffer);
+
+// 11-bit channels, LSB first, back to back
+void packChannels(const int16_t* channels, uint8_t* packed) {
+  memset(packed, 0, CHANNEL_FRAME_PACKED_BYTES);
+
+  uint32_t bitPos = 0;
+  for (int ch = 0; ch < CHANNEL_FRAME_CHANNELS; ch++) {
+    int32_t value = channels[ch];
+    if (value < -1000) value = -1000;
+    if (value > 1000) value = 1000;
+    uint32_t raw = (uint32_t)(value + CHANNEL_FRAME_CENTER);
+
+    for (int bit = 0; bit < CHANNEL_FRAME_BITS; bit++, bitPos++) {
+      if (raw & (1u << bit)) packed[bitPos >> 3] |= (uint8_t)(1u << (bitPos & 7));
+    }
+  }
+}
+
+void unpackChannels(const uint8_t* packed, int16_t* channels) {
+  uint32_t bitPos = 0;
+  for (int ch = 0; ch < CHANNEL_FRAME_CHANNELS; ch++) {
+    uint32_t raw = 0;
+    for (int bit = 0; bit < CHANNEL_FRAME_BITS; bit++, bitPos++) {
+      if (packed[bitPos >> 3] & (1u << (bitPos & 7))) raw |= (1u << bit);
+    }
+    channels[ch] = (int16_t)((int32_t)raw - CHANNEL_FRAME_CENTER);
+  }
+}
+
+void putFrameU16(uint8_t* buffer, uint16_t value) {
+  buffer[0] = (uint8_t)(value & 0xFF);
+  buffer[1] = (uint8_t)(value >> 8);
+}
+
+uint16_t getFrameU16(const uint8_t* buffer) {
+  return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+// buffer must hold CHANNEL_FRAME_SIZE bytes
+void encodeChannelFrame(const ChannelFrame& frame, uint8_t* buffer) {
+  uint8_t* p = buffer;
+  *p++ = CHANNEL_FRAME_TYPE;
+  packChannels(frame.channels, p);
+  p += CHANNEL_FRAME_PACKED_BYTES;
+  putFrameU16(p, frame.switches); p += 2;
+  putFrameU16(p, (uint16_t)(frame.counter & 0xFFFF)); p += 2;
+  putFrameU16(p, (uint16_t)(frame.counter >> 16)); p += 2;
+  putFrameU16(p, (uint16_t)frame.throttleMinPWM); p += 2;
+  putFrameU16(p, (uint16_t)frame.throttleMaxPWM); p += 2;
+  putFrameU16(p, (uint16_t)frame.steerMinDegree); p += 2;
+  putFrameU16(p, (uint16_t)frame.steerNeutralDegree); p += 2;
+  putFrameU16(p, (uint16_t)frame.steerMaxDegree); p += 2;
+  *p++ = frame.configChanged;
+}
+
+// Returns false if the payload is not a channel frame
+bool decodeChannelFrame(const uint8_t* buffer, int length, ChannelFrame& frame) {
+  if (length < CHANNEL_FRAME_SIZE || buffer[0] != CHANNEL_FRAME_TYPE) return false;
+
+  const uint8_t* p = buffer + 1;
+  unpackChannels(p, frame.channels);
+  p += CHANNEL_FRAME_PACKED_BYTES;
+  frame.switches = getFrameU16(p); p += 2;
+  frame.counter = getFrameU16(p); p += 2;
+  frame.counter |= (uint32_t)getFrameU16(p) << 16; p += 2;
+  frame.throttleMinPWM = (int16_t)getFrameU16(p); p += 2;
+  frame.throttleMaxPWM = (int16_t)getFrameU16(p); p += 2;
+  frame.steerMinDegree = (int16_t)getFrameU16(p); p += 2;
+  frame.steerNeutralDegree = (int16_t)getFrameU16(p); p += 2;
+  frame.steerMaxDegree = (int16_t)getFrameU16(p); p += 2;
+  frame.configChanged = *p;
+  return true;
+}
+
+#endif
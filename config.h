@@ -27,6 +27,20 @@ struct RCData {
 // External data variable
 extern RCData data;
 
+// Packet format: 0 = legacy RCData (default), 1 = packed 8 channel frame (channel_frame.h).
+// The receiver must be built with the same format.
+#define USE_CHANNEL_FRAME 0
+
+// 1 = timestamp input snapshots and radio hand-off, report sample age to Serial (latency_probe.h)
+#define USE_LATENCY_PROBE 0
+
+// 1 = count every malloc/realloc, report heap allocations per menu frame to Serial (heap_counter.h)
+#define USE_HEAP_COUNTER 0
+
+// 1 = print every side-effect free screen as a PBM image with render time and CRC32 at boot (display_dump.h).
+// The screens are regression-tested on the host by tests/render_test.cpp - this is for checking on the device.
+#define USE_SCREEN_DUMP 0
+
 // Pin definitions - Teensy 4.0 Optimized layout
 #define RIGHT_JOY_X    A2    // Pin 15 - Steering
 #define RIGHT_JOY_Y    A3    // Pin 14 
@@ -77,8 +91,12 @@ extern RCData data;
 
 // Timing constants
 #define TRANSMIT_INTERVAL 20    // 50Hz transmission
+#define TX_SAMPLE_LEAD_US 2000  // Stick acquisition window before each TX deadline (0 = sample on the deadline)
+#define TX_OVERSAMPLE_ROUNDS 4  // ADC rounds averaged inside the window
 #define DISPLAY_INTERVAL 50     // 20Hz display update
-#define DEADZONE_THRESHOLD 50   // Joystick deadzone
+#define DISPLAY_BUDGET_US 500   // Display work (render slices + I2C transactions) per loop() pass
+#define DISPLAY_MAX_STALE_MS 1000  // Unchanged main screen is still redrawn this often
+#define DISPLAY_RAW_HYSTERESIS 4   // RAW column changes up to this many ADC counts don't count as a change
 
 // Debug constants
 #define DEBUG_INTERVAL 100      // Print debug every 100 packets
@@ -123,13 +141,8 @@ struct FactoryDefaults {
   bool alertSounds = true;
   bool musicEnabled = true;
   
-  // Calibration defaults
-  int rightJoyX_min = 0, rightJoyX_neutral = 512, rightJoyX_max = 1023;
-  int rightJoyY_min = 0, rightJoyY_neutral = 512, rightJoyY_max = 1023;
-  int leftJoyX_min = 0, leftJoyX_neutral = 512, leftJoyX_max = 1023;
-  int leftJoyY_min = 0, leftJoyY_neutral = 512, leftJoyY_max = 1023;
-  int leftPot_min = 0, leftPot_neutral = 512, leftPot_max = 1023;
-  int rightPot_min = 0, rightPot_neutral = 512, rightPot_max = 1023;
+  // Calibration defaults (all analog axes)
+  int axisMin = 0, axisNeutral = 512, axisMax = 1023;
 };
 
 extern FactoryDefaults factoryDefaults;
@@ -8,43 +8,136 @@
 
 #include "config.h"
 #include "audio.h"
+#include "curves.h"
+#include "mixer.h"
+#include "channel_frame.h"
+#include "input_events.h"
+#include "deadzone.h"
+#include "trims.h"
+#include "slew.h"
+#include "axes.h"
+#include "latency_probe.h"
+#include "logic_switches.h"
 
 // Forward declare calibration functions
-extern int getCalibratedSteering();
-extern int getCalibratedThrottle();
+extern int getCalibratedAxis(int axis);
+extern int calibrateAxis(int axis, int raw);
+
+// Button identifiers - bit positions in the button masks
+enum ButtonId {
+  BTN_LEFT_TRIGGER_DOWN = 0,
+  BTN_LEFT_TRIGGER_UP,
+  BTN_RIGHT_TRIGGER_DOWN,
+  BTN_RIGHT_TRIGGER_UP,
+  BTN_RIGHT_JOY,
+  BTN_LEFT_JOY,
+  BTN_LEFT,
+  BTN_RIGHT,
+  BTN_UP,
+  BTN_DOWN,
+  BTN_OK,
+  NUM_BUTTONS,
+  
+  // Virtual inputs - stick deflection used for menu navigation
+  BTN_STICK_UP = NUM_BUTTONS,
+  BTN_STICK_DOWN,
+  BTN_STICK_LEFT,
+  BTN_STICK_RIGHT,
+  NUM_INPUTS
+};
+
+#define BUTTON_MASK(id) ((uint16_t)(1u << (id)))
+
+// Three-position trigger decode
+enum TriggerState {
+  TRIGGER_UP = 0,
+  TRIGGER_MIDDLE = 1,
+  TRIGGER_DOWN = 2
+};
+
+// Debounced input masks - bit set = pressed. Edges are collected once per
+// checkButtons() call and are valid for exactly one loop() pass.
+struct ButtonStates {
+  uint16_t pressed;        // Current state
+  uint16_t pressedEdges;   // Went down since the previous scan
+  uint16_t releasedEdges;  // Went up since the previous scan
+  uint16_t repeatEdges;    // Auto-repeat ticks since the previous scan
+};
+
+ButtonStates buttons;
+
+// Button pins in ButtonId order (all INPUT_PULLUP, LOW = pressed)
+const uint8_t buttonPins[NUM_BUTTONS] = {
+  LEFT_TRIGGER_DOWN, LEFT_TRIGGER_UP, RIGHT_TRIGGER_DOWN, RIGHT_TRIGGER_UP,
+  RIGHT_JOY_BTN, LEFT_JOY_BTN,
+  BUTTON_LEFT, BUTTON_RIGHT, BUTTON_UP, BUTTON_DOWN, BUTTON_OK
+};
+
+// Bulk GPIO read tables - each GPIO port input register is read once per scan
+#define MAX_BUTTON_PORTS 4
+volatile uint32_t* buttonPortRegs[MAX_BUTTON_PORTS];
+int numButtonPorts = 0;
+uint8_t buttonPortIndex[NUM_BUTTONS];
+uint32_t buttonBitMask[NUM_BUTTONS];
+
+// Pin-change capture - the ISR snapshots all button ports on every edge so
+// taps during blocking work (display flush, radio retries, setup delays)
+// are kept with their real timestamps until checkButtons() drains them
+#define BUTTON_CAPTURE_SIZE 64           // Must be a power of two
+volatile uint16_t captureMask[BUTTON_CAPTURE_SIZE];
+volatile uint32_t captureMicros[BUTTON_CAPTURE_SIZE];
+volatile uint8_t captureHead = 0;        // Written by the ISR only
+volatile uint8_t captureTail = 0;        // Written by checkButtons() only
+volatile uint16_t isrLastMask = 0;
+volatile uint32_t captureOverflows = 0;
 
 // Function declarations
 void initControls();
 void readJoysticks();
+int readConditionedAxis(int axis);
+bool isControlInputUsed(int input);
+void updateSwitchChannels();
+TriggerState readTriggerState(ButtonId upButton, ButtonId downButton);
+int getTriggerChannel(TriggerState state);
+void beginAxisSampling(uint32_t deadline);
+void updateAxisSampling();
+bool isAxisSampled(int axis);
+int readSampledAxisRaw(int axis);
 void checkButtons();
 void setLED(bool red, bool green, bool blue);
 bool getArmedStatus();
-
-// Button state variables
-struct ButtonStates {
-  bool leftTriggerDown;
-  bool leftTriggerUp;
-  bool rightTriggerDown;
-  bool rightTriggerUp;
-  bool rightJoyBtn;
-  bool leftJoyBtn;
-  bool btnLeft;
-  bool btnRight;
-  bool btnUp;
-  bool btnDown;
-  bool btnOK;
-};
-
-ButtonStates buttons;
+void initButtonPorts();
+uint16_t readButtonMask();
+uint16_t readNavigationSticks();
+void buttonChangeISR();
+uint32_t getButtonCaptureOverflows();
+const ButtonStates& getButtonStates();
+bool isButtonDown(ButtonId id);
+bool wasButtonPressed(ButtonId id);
+bool wasButtonReleased(ButtonId id);
+bool wasButtonRepeated(ButtonId id);
+void handleTrimButtons();
+bool isLowRateActive();
+uint16_t getSwitchBits();
 
 // Arming system
 bool isArmed = false;
-bool lastLeftTriggerDown = false;
 
 // Potentiometer values
 int leftPotValue = 0;
 int rightPotValue = 0;
 
+// Raw stick readings of the last tick, for the main screen's RAW column
+int rawThrottleValue = 0;
+int rawSteeringValue = 0;
+
+// Send-time sampling - ADC rounds spread evenly over the TX_SAMPLE_LEAD_US
+// window before the TX deadline and averaged by readJoysticks()
+uint32_t axisSampleSum[NUM_AXES];
+uint8_t axisSampleHits[NUM_AXES];    // Rounds that included each axis
+uint8_t axisSampleCount = 0;         // Rounds taken in the current window
+uint32_t nextAxisSampleMicros = 0;
+
 void initControls() {
   Serial.println("Initializing controls for Teensy 4.0...");
   
@@ -53,18 +146,23 @@ void initControls() {
   pinMode(LED_GREEN, OUTPUT);
   pinMode(LED_BLUE, OUTPUT);
   
-  // Setup button pins with pull-up resistors
-  pinMode(LEFT_TRIGGER_DOWN, INPUT_PULLUP);   // LOW = pressed
-  pinMode(LEFT_TRIGGER_UP, INPUT_PULLUP);     // LOW = pressed
-  pinMode(RIGHT_TRIGGER_DOWN, INPUT_PULLUP);  // LOW = pressed
-  pinMode(RIGHT_TRIGGER_UP, INPUT_PULLUP);    // LOW = pressed
-  pinMode(RIGHT_JOY_BTN, INPUT_PULLUP);       // LOW = pressed
-  pinMode(LEFT_JOY_BTN, INPUT_PULLUP);        // LOW = pressed
-  pinMode(BUTTON_LEFT, INPUT_PULLUP);         // LOW = pressed
-  pinMode(BUTTON_OK, INPUT_PULLUP);           // LOW = pressed
-  pinMode(BUTTON_DOWN, INPUT_PULLUP);         // LOW = pressed
-  pinMode(BUTTON_UP, INPUT_PULLUP);           // LOW = pressed
-  pinMode(BUTTON_RIGHT, INPUT_PULLUP);        // LOW = pressed
+  // Setup button pins with pull-up resistors (LOW = pressed)
+  for (int i = 0; i < NUM_BUTTONS; i++) {
+    pinMode(buttonPins[i], INPUT_PULLUP);
+  }
+  initButtonPorts();
+  
+  // Capture every button edge in the background
+  isrLastMask = readButtonMask();
+  for (int i = 0; i < NUM_BUTTONS; i++) {
+    attachInterrupt(digitalPinToInterrupt(buttonPins[i]), buttonChangeISR, CHANGE);
+  }
+  
+  // Arrow keys, stick navigation and the trim trigger auto-repeat, other buttons report long-presses
+  initInputEvents(BUTTON_MASK(BTN_LEFT) | BUTTON_MASK(BTN_RIGHT) | BUTTON_MASK(BTN_UP) | BUTTON_MASK(BTN_DOWN) |
+                  BUTTON_MASK(BTN_STICK_UP) | BUTTON_MASK(BTN_STICK_DOWN) |
+                  BUTTON_MASK(BTN_STICK_LEFT) | BUTTON_MASK(BTN_STICK_RIGHT) |
+                  BUTTON_MASK(BTN_RIGHT_TRIGGER_UP) | BUTTON_MASK(BTN_RIGHT_TRIGGER_DOWN));
   
   // Set initial LED state - let menu system handle this
   // All LEDs off initially until menu system initializes
@@ -76,54 +174,259 @@ void initControls() {
 }
 
 void readJoysticks() {
+#if USE_LATENCY_PROBE
+  if (axisSampleCount == 0) markInputSnapshot();  // No window samples - acquired now
+#endif
+  
   // Only process joystick inputs if ARMED
   if (isArmed) {
     // Use calibrated values if available, otherwise use default mapping
-    data.steering = getCalibratedSteering();
-    data.throttle = getCalibratedThrottle();
+    // Single deadzone stage: each sample is conditioned exactly once per tick
+    data.steering = readConditionedAxis(AXIS_RIGHT_X);
+    data.throttle = readConditionedAxis(AXIS_LEFT_Y);
+    
+    // Apply expo/curve and the selected rate (precompiled lookup tables), then the trim offset
+    bool lowRate = isLowRateActive();
+    mixerInputs[MIX_IN_STEERING] = applyTrim(TRIM_STEERING, applyChannelCurve(CURVE_STEERING, data.steering, lowRate));
+    mixerInputs[MIX_IN_THROTTLE] = applyTrim(TRIM_THROTTLE, applyChannelCurve(CURVE_THROTTLE, data.throttle, lowRate));
+    
+    // Auxiliary inputs are only sampled when a mix or logic switch uses them
+    mixerInputs[MIX_IN_RIGHT_Y] = isControlInputUsed(MIX_IN_RIGHT_Y) ? readConditionedAxis(AXIS_RIGHT_Y) : 0;
+    mixerInputs[MIX_IN_LEFT_X] = isControlInputUsed(MIX_IN_LEFT_X) ? readConditionedAxis(AXIS_LEFT_X) : 0;
+    mixerInputs[MIX_IN_LEFT_POT] = isControlInputUsed(MIX_IN_LEFT_POT) ? readConditionedAxis(AXIS_LEFT_POT) : 0;
+    mixerInputs[MIX_IN_RIGHT_POT] = isControlInputUsed(MIX_IN_RIGHT_POT) ? readConditionedAxis(AXIS_RIGHT_POT) : 0;
+    
+    // Logic switches see this tick's inputs (the rate switch above used the previous tick)
+    updateSwitchChannels();
+    runLogicSwitches();
     
-    // Apply deadzone to prevent drift
-    if (abs(data.steering) < DEADZONE_THRESHOLD) data.steering = 0;
-    if (abs(data.throttle) < DEADZONE_THRESHOLD) data.throttle = 0;
+    // Mix into the output channels, then limit how fast each one may move
+    runMixer();
+    applySlew(mixerOutputs, MIX_SENT_OUTPUTS);
+    data.throttle = mixerOutputs[MIX_OUT_THROTTLE];
+    data.steering = mixerOutputs[MIX_OUT_STEERING];
   } else {
-    // DISARMED - force neutral values
+    // DISARMED - force neutral values immediately (bypasses the slew limiter)
     data.steering = 0;
     data.throttle = 0;
+    memset(mixerOutputs, 0, sizeof(mixerOutputs));
+    resetSlewState();
+    
+    // Logic switches keep running with the sticks at neutral - the pots are
+    // still sampled, so switches that use them see their real position
+    memset(mixerInputs, 0, sizeof(mixerInputs));
+    mixerInputs[MIX_IN_LEFT_POT] = isControlInputUsed(MIX_IN_LEFT_POT) ? readConditionedAxis(AXIS_LEFT_POT) : 0;
+    mixerInputs[MIX_IN_RIGHT_POT] = isControlInputUsed(MIX_IN_RIGHT_POT) ? readConditionedAxis(AXIS_RIGHT_POT) : 0;
+    updateSwitchChannels();
+    runLogicSwitches();
   }
   
   // Read potentiometers (always active)
-  leftPotValue = analogRead(LEFT_POT);
-  rightPotValue = analogRead(RIGHT_POT);
+  leftPotValue = readSampledAxisRaw(AXIS_LEFT_POT);
+  rightPotValue = readSampledAxisRaw(AXIS_RIGHT_POT);
+  
+  // Window averages while armed; read at the tick while disarmed (the sticks are not in the window then)
+  rawThrottleValue = readSampledAxisRaw(AXIS_LEFT_Y);
+  rawSteeringValue = readSampledAxisRaw(AXIS_RIGHT_X);
+  
+  // Window consumed - the next tick starts a fresh one
+  memset(axisSampleHits, 0, sizeof(axisSampleHits));
+  axisSampleCount = 0;
+}
+
+// Calibrated axis through its deadzone stage (if the axis has one)
+int readConditionedAxis(int axis) {
+  int value = calibrateAxis(axis, readSampledAxisRaw(axis));
+  int deadzoneAxis = axisTable[axis].deadzoneAxis;
+  return deadzoneAxis >= 0 ? applyDeadzone(deadzoneAxis, value) : value;
+}
+
+bool isControlInputUsed(int input) {
+  return isMixerInputUsed(input) || isLogicInputUsed(input);
+}
+
+// Copy this tick's inputs and switch positions into the logic switch sources
+void updateSwitchChannels() {
+  for (int input = 0; input < NUM_MIX_INPUTS; input++) {
+    logicSources[input] = mixerInputs[input];
+  }
+  logicSources[LS_SRC_LEFT_TRIGGER] = getTriggerChannel(readTriggerState(BTN_LEFT_TRIGGER_UP, BTN_LEFT_TRIGGER_DOWN));
+  logicSources[LS_SRC_RIGHT_TRIGGER] = getTriggerChannel(readTriggerState(BTN_RIGHT_TRIGGER_UP, BTN_RIGHT_TRIGGER_DOWN));
+  logicSources[LS_SRC_LEFT_JOY_BTN] = isButtonDown(BTN_LEFT_JOY) ? 1000 : 0;
+  logicSources[LS_SRC_RIGHT_JOY_BTN] = isButtonDown(BTN_RIGHT_JOY) ? 1000 : 0;
+  logicSources[LS_SRC_ARMED] = isArmed ? 1000 : 0;
+}
+
+TriggerState readTriggerState(ButtonId upButton, ButtonId downButton) {
+  bool up = isButtonDown(upButton);
+  bool down = isButtonDown(downButton);
+  
+  if (up && !down) return TRIGGER_UP;
+  if (down && !up) return TRIGGER_DOWN;
+  return TRIGGER_MIDDLE;
+}
+
+int getTriggerChannel(TriggerState state) {
+  switch (state) {
+    case TRIGGER_UP: return 1000;
+    case TRIGGER_DOWN: return -1000;
+    default: return 0;
+  }
+}
+
+// Open the acquisition window for the TX tick due at deadline (micros)
+void beginAxisSampling(uint32_t deadline) {
+  memset(axisSampleSum, 0, sizeof(axisSampleSum));
+  memset(axisSampleHits, 0, sizeof(axisSampleHits));
+  axisSampleCount = 0;
+  nextAxisSampleMicros = deadline - TX_SAMPLE_LEAD_US;
+}
+
+// One ADC round when the next slot in the window is due
+void updateAxisSampling() {
+  if (axisSampleCount >= TX_OVERSAMPLE_ROUNDS) return;
+  if ((int32_t)(micros() - nextAxisSampleMicros) < 0) return;
+  
+#if USE_LATENCY_PROBE
+  if (axisSampleCount == 0) markInputSnapshot();  // Age is measured from the oldest sample
+#endif
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    if (isAxisSampled(axis)) {
+      axisSampleSum[axis] += analogRead(axisTable[axis].pin);
+      axisSampleHits[axis]++;
+    }
+  }
+  axisSampleCount++;
+  nextAxisSampleMicros += TX_SAMPLE_LEAD_US / TX_OVERSAMPLE_ROUNDS;
+}
+
+// Only the axes the next frame uses are converted
+bool isAxisSampled(int axis) {
+  switch (axis) {
+    case AXIS_RIGHT_X:
+    case AXIS_LEFT_Y:
+      return isArmed;
+    case AXIS_RIGHT_Y:
+      return isArmed && isControlInputUsed(MIX_IN_RIGHT_Y);
+    case AXIS_LEFT_X:
+      return isArmed && isControlInputUsed(MIX_IN_LEFT_X);
+    default:
+      return true;  // Pots are always reported
+  }
+}
+
+// Window average, or a direct read if no round in the window included the axis
+int readSampledAxisRaw(int axis) {
+  uint8_t hits = axisSampleHits[axis];
+  if (hits == 0) return analogRead(axisTable[axis].pin);
+  return (axisSampleSum[axis] + hits / 2) / hits;
+}
+
+// Resolve every button pin to its GPIO input register and bit so a scan
+// needs one register read per port instead of one digitalRead() per button
+void initButtonPorts() {
+  numButtonPorts = 0;
+  
+  for (int i = 0; i < NUM_BUTTONS; i++) {
+    volatile uint32_t* reg = portInputRegister(buttonPins[i]);
+    int port = 0;
+    while (port < numButtonPorts && buttonPortRegs[port] != reg) port++;
+    if (port == numButtonPorts && numButtonPorts < MAX_BUTTON_PORTS) {
+      buttonPortRegs[numButtonPorts++] = reg;
+    }
+    buttonPortIndex[i] = port;
+    buttonBitMask[i] = digitalPinToBitMask(buttonPins[i]);
+  }
+  
+  Serial.print("Buttons mapped to ");
+  Serial.print(numButtonPorts);
+  Serial.println(" GPIO ports");
+}
+
+uint16_t readButtonMask() {
+  uint32_t portSnapshot[MAX_BUTTON_PORTS];
+  for (int port = 0; port < numButtonPorts; port++) {
+    portSnapshot[port] = *buttonPortRegs[port];
+  }
+  
+  uint16_t pressed = 0;
+  for (int i = 0; i < NUM_BUTTONS; i++) {
+    if (!(portSnapshot[buttonPortIndex[i]] & buttonBitMask[i])) {
+      pressed |= BUTTON_MASK(i);  // LOW input = pressed
+    }
+  }
+  return pressed;
+}
+
+// Stick deflection as virtual buttons - only sampled while the menu is open
+uint16_t readNavigationSticks() {
+  extern bool isMenuActive();
+  if (!isMenuActive()) return 0;
+  
+  int rightJoyY = analogRead(axisTable[AXIS_RIGHT_Y].pin);
+  int leftJoyY = analogRead(axisTable[AXIS_LEFT_Y].pin);
+  int rightJoyX = analogRead(axisTable[AXIS_RIGHT_X].pin);
+  int leftJoyX = analogRead(axisTable[AXIS_LEFT_X].pin);
+  
+  uint16_t sticks = 0;
+  if (rightJoyY < 200 || leftJoyY > 800) sticks |= BUTTON_MASK(BTN_STICK_UP);
+  if (rightJoyY > 800 || leftJoyY < 200) sticks |= BUTTON_MASK(BTN_STICK_DOWN);
+  if (rightJoyX < 200 || leftJoyX > 800) sticks |= BUTTON_MASK(BTN_STICK_LEFT);
+  if (rightJoyX > 800 || leftJoyX < 200) sticks |= BUTTON_MASK(BTN_STICK_RIGHT);
+  return sticks;
+}
+
+// Shared by all button pins - one port snapshot per edge, timestamped on entry
+void buttonChangeISR() {
+  uint32_t now = micros();
+  uint16_t mask = readButtonMask();
+  if (mask == isrLastMask) return;  // Edge already captured by another pin's interrupt
+  isrLastMask = mask;
+  
+  uint8_t head = captureHead;
+  uint8_t next = (head + 1) & (BUTTON_CAPTURE_SIZE - 1);
+  if (next == captureTail) {
+    captureOverflows++;  // checkButtons() resyncs from a fresh snapshot
+    return;
+  }
+  captureMask[head] = mask;
+  captureMicros[head] = now;
+  captureHead = next;
+}
+
+uint32_t getButtonCaptureOverflows() {
+  return captureOverflows;
 }
 
 void checkButtons() {
-  // Store previous trigger state
-  lastLeftTriggerDown = buttons.leftTriggerDown;
-  
-  // Read all button states (LOW = pressed due to INPUT_PULLUP)
-  buttons.leftTriggerDown = !digitalRead(LEFT_TRIGGER_DOWN);     // Invert: LOW input = true pressed
-  buttons.leftTriggerUp = !digitalRead(LEFT_TRIGGER_UP);
-  buttons.rightTriggerDown = !digitalRead(RIGHT_TRIGGER_DOWN);
-  buttons.rightTriggerUp = !digitalRead(RIGHT_TRIGGER_UP);
-  buttons.rightJoyBtn = !digitalRead(RIGHT_JOY_BTN);
-  buttons.leftJoyBtn = !digitalRead(LEFT_JOY_BTN);
-  buttons.btnLeft = !digitalRead(BUTTON_LEFT);
-  buttons.btnRight = !digitalRead(BUTTON_RIGHT);
-  buttons.btnUp = !digitalRead(BUTTON_UP);
-  buttons.btnDown = !digitalRead(BUTTON_DOWN);
-  buttons.btnOK = !digitalRead(BUTTON_OK);
+  uint16_t sticks = readNavigationSticks();
+  
+  // Replay captured edges in order, then the current level
+  uint8_t tail = captureTail;
+  while (tail != captureHead) {
+    feedInputMask(captureMask[tail] | sticks, captureMicros[tail], NUM_INPUTS);
+    tail = (tail + 1) & (BUTTON_CAPTURE_SIZE - 1);
+    captureTail = tail;
+  }
+  
+  // Debounce and generate menu input events
+  buttons.pressed = updateInputEvents(readButtonMask() | sticks, NUM_INPUTS);
+  takeInputEdges(buttons.pressedEdges, buttons.releasedEdges, buttons.repeatEdges);
   
   // ARMING LOGIC: Left trigger down = ARMED
-  if (buttons.leftTriggerDown && !lastLeftTriggerDown) {
+  if (wasButtonPressed(BTN_LEFT_TRIGGER_DOWN)) {
     // Trigger just pressed - ARM the system
     isArmed = true;
-    Serial.println("SYSTEM ARMED!");
+    Serial.print("SYSTEM ARMED! (trigger edge ");
+    Serial.print(micros() - getInputPressMicros(BTN_LEFT_TRIGGER_DOWN));
+    Serial.println(" us ago)");
     playArmSound();
     // Use applyLEDSettings() instead of direct setLED() call
     extern void applyLEDSettings();
     applyLEDSettings();
-  } else if (!buttons.leftTriggerDown && lastLeftTriggerDown) {
-    // Trigger just released - DISARM the system
+  }
+  if (wasButtonReleased(BTN_LEFT_TRIGGER_DOWN) && !isButtonDown(BTN_LEFT_TRIGGER_DOWN)) {
+    // Trigger released (possibly a short tap within this batch) - DISARM the system
     isArmed = false;
     Serial.println("SYSTEM DISARMED!");
     playDisarmSound();
@@ -131,6 +434,27 @@ void checkButtons() {
     extern void applyLEDSettings();
     applyLEDSettings();
   }
+  
+  handleTrimButtons();
+}
+
+// TRIMS: Right trigger up/down steps the steering trim, with the left stick
+// button held it steps the throttle trim. A trigger position bound to the
+// rate switch does not trim.
+void handleTrimButtons() {
+  extern bool isMenuActive();
+  if (isMenuActive()) return;
+  
+  int channel = isButtonDown(BTN_LEFT_JOY) ? TRIM_THROTTLE : TRIM_STEERING;
+  
+  if (curveData.rateSwitch != RATE_SWITCH_RIGHT_UP) {
+    if (wasButtonPressed(BTN_RIGHT_TRIGGER_UP)) stepTrim(channel, 1, false);
+    else if (wasButtonRepeated(BTN_RIGHT_TRIGGER_UP)) stepTrim(channel, 1, true);
+  }
+  if (curveData.rateSwitch != RATE_SWITCH_RIGHT_DOWN) {
+    if (wasButtonPressed(BTN_RIGHT_TRIGGER_DOWN)) stepTrim(channel, -1, false);
+    else if (wasButtonRepeated(BTN_RIGHT_TRIGGER_DOWN)) stepTrim(channel, -1, true);
+  }
 }
 
 void setLED(bool red, bool green, bool blue) {
@@ -161,10 +485,57 @@ int getRightPot() {
   return rightPotValue;
 }
 
-ButtonStates getButtonStates() {
+const ButtonStates& getButtonStates() {
   return buttons;
 }
 
+bool isButtonDown(ButtonId id) {
+  return buttons.pressed & BUTTON_MASK(id);
+}
+
+bool wasButtonPressed(ButtonId id) {
+  return buttons.pressedEdges & BUTTON_MASK(id);
+}
+
+bool wasButtonReleased(ButtonId id) {
+  return buttons.releasedEdges & BUTTON_MASK(id);
+}
+
+bool wasButtonRepeated(ButtonId id) {
+  return buttons.repeatEdges & BUTTON_MASK(id);
+}
+
+// Switch bitfield for the channel frame (trigger positions, stick buttons, arm/rate state, logic switches)
+uint16_t getSwitchBits() {
+  uint16_t bits = 0;
+  if (isArmed) {
+    TriggerState leftTrigger = readTriggerState(BTN_LEFT_TRIGGER_UP, BTN_LEFT_TRIGGER_DOWN);
+    TriggerState rightTrigger = readTriggerState(BTN_RIGHT_TRIGGER_UP, BTN_RIGHT_TRIGGER_DOWN);
+    if (leftTrigger == TRIGGER_UP) bits |= 1 << SWITCH_LEFT_TRIGGER_SHIFT;
+    else if (leftTrigger == TRIGGER_DOWN) bits |= 2 << SWITCH_LEFT_TRIGGER_SHIFT;
+    if (rightTrigger == TRIGGER_UP) bits |= 1 << SWITCH_RIGHT_TRIGGER_SHIFT;
+    else if (rightTrigger == TRIGGER_DOWN) bits |= 2 << SWITCH_RIGHT_TRIGGER_SHIFT;
+    if (isButtonDown(BTN_LEFT_JOY)) bits |= SWITCH_LEFT_JOY_BTN;
+    if (isButtonDown(BTN_RIGHT_JOY)) bits |= SWITCH_RIGHT_JOY_BTN;
+    bits |= SWITCH_ARMED;
+    if (isLowRateActive()) bits |= SWITCH_LOW_RATE;
+  }
+  
+  // Logic switches are evaluated armed or not - they can drive aux outputs and alarms
+  bits |= (uint16_t)logicSwitchBits << SWITCH_LOGIC_SHIFT;
+  return bits;
+}
+
+// Dual-rate switch - low rate while the bound trigger position is held
+bool isLowRateActive() {
+  switch (curveData.rateSwitch) {
+    case RATE_SWITCH_RIGHT_UP: return isButtonDown(BTN_RIGHT_TRIGGER_UP);
+    case RATE_SWITCH_RIGHT_DOWN: return isButtonDown(BTN_RIGHT_TRIGGER_DOWN);
+    case RATE_SWITCH_NONE: return false;
+    default: return isLogicSwitchOn(curveData.rateSwitch - RATE_SWITCH_LOGIC);
+  }
+}
+
 // Arming system functions
 bool getArmedStatus() {
   return isArmed;
@@ -0,0 +1,216 @@
+/*
+  curves.h - Expo, Dual-Rate and Multi-Point Curve Engine
+  RC Transmitter for Teensy 4.0
+
+  Each control channel has an expo value, a high and a low rate and an
+  optional 5 or 9 point curve. Whenever the settings change they are
+  compiled into lookup tables (one per rate), so the TX tick only does a
+  single table lookup with linear interpolation - no float math.
+*/
+
+#ifndef CURVES_H
+#define CURVES_H
+
+#include <EEPROM.h>
+#include "config.h"
+#include "logic_switches.h"
+
+// EEPROM layout: calibration at 0, curves at 128, settings at 512 (see menu_data.h)
+#define EEPROM_CURVES_ADDRESS 128
+#define CURVES_SIGNATURE 0xC0DE
+
+// Lookup table resolution - 128 segments across -1000..+1000
+#define CURVE_LUT_SIZE 129
+#define CURVE_MAX_POINTS 9
+
+// Channels that go through the curve engine
+enum CurveChannel {
+  CURVE_STEERING = 0,
+  CURVE_THROTTLE = 1,
+  NUM_CURVE_CHANNELS
+};
+
+// Curve shape applied before the rate
+enum CurveType {
+  CURVE_TYPE_EXPO = 0,   // Expo only (0% = linear)
+  CURVE_TYPE_5PT = 1,    // 5 point curve
+  CURVE_TYPE_9PT = 2     // 9 point curve
+};
+
+// Which trigger position (or logic switch) selects the low rate
+enum RateSwitchSource {
+  RATE_SWITCH_NONE = 0,
+  RATE_SWITCH_RIGHT_UP = 1,
+  RATE_SWITCH_RIGHT_DOWN = 2,
+  RATE_SWITCH_LOGIC = 3,              // + logic switch index (L1..L6)
+  NUM_RATE_SWITCHES = RATE_SWITCH_LOGIC + NUM_LOGIC_SWITCHES
+};
+
+// Per-channel curve settings
+struct ChannelCurve {
+  int8_t expo;                        // -100 to +100 (positive = softer centre)
+  uint8_t rateHigh;                   // 0-100 %
+  uint8_t rateLow;                    // 0-100 %
+  uint8_t curveType;                  // CurveType
+  int16_t points[CURVE_MAX_POINTS];   // -1000 to +1000, 5PT uses every second point
+};
+
+// Curve data stored in EEPROM
+struct CurveData {
+  ChannelCurve channels[NUM_CURVE_CHANNELS];
+  uint8_t rateSwitch;                 // RateSwitchSource
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+CurveData curveData;
+
+// Compiled lookup tables [channel][0 = high rate, 1 = low rate]
+int16_t curveLUT[NUM_CURVE_CHANNELS][2][CURVE_LUT_SIZE];
+
+// Function declarations
+void initCurves();
+void saveCurves();
+void loadCurves();
+void resetCurves();
+void resetChannelCurve(int channel);
+void compileCurves();
+int applyChannelCurve(int channel, int value, bool lowRate);
+int getCurvePointCount(int channel);
+int getCurvePointSlot(int pointCount, int index);
+float evaluateCurveShape(const ChannelCurve& curve, float x);
+const char* getCurveTypeName(int curveType);
+const char* getRateSwitchName(int rateSwitch);
+
+void initCurves() {
+  loadCurves();
+  compileCurves();
+  Serial.println("Curves compiled into lookup tables");
+}
+
+void saveCurves() {
+  curveData.signature = CURVES_SIGNATURE;
+  EEPROM.put(EEPROM_CURVES_ADDRESS, curveData);
+  Serial.println("Curves saved to EEPROM");
+}
+
+void loadCurves() {
+  EEPROM.get(EEPROM_CURVES_ADDRESS, curveData);
+
+  if (curveData.signature != CURVES_SIGNATURE) {
+    Serial.println("No valid curves found, using defaults");
+    resetCurves();
+  } else {
+    Serial.println("Curves loaded from EEPROM");
+  }
+}
+
+void resetCurves() {
+  for (int ch = 0; ch < NUM_CURVE_CHANNELS; ch++) {
+    resetChannelCurve(ch);
+  }
+  curveData.rateSwitch = RATE_SWITCH_NONE;
+  curveData.signature = CURVES_SIGNATURE;
+}
+
+void resetChannelCurve(int channel) {
+  ChannelCurve& curve = curveData.channels[channel];
+  curve.expo = 0;          // Linear
+  curve.rateHigh = 100;    // Full throw
+  curve.rateLow = 60;      // Typical low rate
+  curve.curveType = CURVE_TYPE_EXPO;
+
+  // Straight line through all 9 points
+  for (int i = 0; i < CURVE_MAX_POINTS; i++) {
+    curve.points[i] = -1000 + (i * 2000) / (CURVE_MAX_POINTS - 1);
+  }
+}
+
+int getCurvePointCount(int channel) {
+  return curveData.channels[channel].curveType == CURVE_TYPE_5PT ? 5 : CURVE_MAX_POINTS;
+}
+
+// Map a point index of a 5 or 9 point curve onto the 9 stored points
+int getCurvePointSlot(int pointCount, int index) {
+  return index * (CURVE_MAX_POINTS - 1) / (pointCount - 1);
+}
+
+// Evaluate the curve shape (without rate) for x in -1.0..+1.0
+float evaluateCurveShape(const ChannelCurve& curve, float x) {
+  if (curve.curveType == CURVE_TYPE_5PT || curve.curveType == CURVE_TYPE_9PT) {
+    // Piecewise linear through equally spaced points
+    int pointCount = (curve.curveType == CURVE_TYPE_5PT) ? 5 : CURVE_MAX_POINTS;
+    float pos = (x + 1.0) * 0.5 * (pointCount - 1);
+    int seg = (int)pos;
+    if (seg >= pointCount - 1) seg = pointCount - 2;
+    if (seg < 0) seg = 0;
+    float frac = pos - seg;
+    float y0 = curve.points[getCurvePointSlot(pointCount, seg)] / 1000.0;
+    float y1 = curve.points[getCurvePointSlot(pointCount, seg + 1)] / 1000.0;
+    return y0 + (y1 - y0) * frac;
+  }
+
+  // Expo: y = (1 - k) * x + k * x^3 for positive expo.
+  // Negative expo mirrors the curve so the centre becomes more sensitive.
+  float k = curve.expo / 100.0;
+  float ax = fabs(x);
+  float ay;
+  if (k >= 0) {
+    ay = (1.0 - k) * ax + k * ax * ax * ax;
+  } else {
+    float inv = 1.0 - ax;
+    ay = 1.0 - ((1.0 + k) * inv - k * inv * inv * inv);
+  }
+  return x < 0 ? -ay : ay;
+}
+
+void compileCurves() {
+  for (int ch = 0; ch < NUM_CURVE_CHANNELS; ch++) {
+    const ChannelCurve& curve = curveData.channels[ch];
+
+    for (int i = 0; i < CURVE_LUT_SIZE; i++) {
+      float x = -1.0 + (2.0 * i) / (CURVE_LUT_SIZE - 1);
+      float y = evaluateCurveShape(curve, x) * 1000.0;
+
+      int high = (int)(y * curve.rateHigh / 100.0);
+      int low = (int)(y * curve.rateLow / 100.0);
+      curveLUT[ch][0][i] = constrain(high, -1000, 1000);
+      curveLUT[ch][1][i] = constrain(low, -1000, 1000);
+    }
+  }
+}
+
+// Per-tick curve application: table lookup with linear interpolation
+int applyChannelCurve(int channel, int value, bool lowRate) {
+  const int16_t* lut = curveLUT[channel][lowRate ? 1 : 0];
+
+  value = constrain(value, -1000, 1000);
+  int32_t pos = (int32_t)(value + 1000) * (CURVE_LUT_SIZE - 1);
+  int idx = pos / 2000;
+  int frac = pos % 2000;
+
+  if (idx >= CURVE_LUT_SIZE - 1) return lut[CURVE_LUT_SIZE - 1];
+  return lut[idx] + ((int32_t)(lut[idx + 1] - lut[idx]) * frac) / 2000;
+}
+
+const char* getCurveTypeName(int curveType) {
+  switch (curveType) {
+    case CURVE_TYPE_5PT: return "5PT";
+    case CURVE_TYPE_9PT: return "9PT";
+    default: return "EXPO";
+  }
+}
+
+const char* getRateSwitchName(int rateSwitch) {
+  switch (rateSwitch) {
+    case RATE_SWITCH_RIGHT_UP: return "RT-UP";
+    case RATE_SWITCH_RIGHT_DOWN: return "RT-DN";
+    case RATE_SWITCH_NONE: return "NONE";
+    default:
+      if (rateSwitch < NUM_RATE_SWITCHES) return getLogicSourceName(LS_SRC_LOGIC + rateSwitch - RATE_SWITCH_LOGIC);
+      return "NONE";
+  }
+}
+
+#endif
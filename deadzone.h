@@ -0,0 +1,134 @@
+/*
+  deadzone.h - Per-Axis Deadzone with Centre Hysteresis
+  RC Transmitter for Teensy 4.0
+
+  The only deadzone stage in the input pipeline. Leaving the centre needs
+  the deadzone plus a hysteresis margin, coming back only the deadzone,
+  so a stick resting on the edge does not chatter. The travel past the
+  leaving edge is rescaled to the full -1000..+1000 range, so the output
+  starts from 0 there and is continuous both ways. Scale factors are
+  compiled when the values change; the per-tick work is one compare and
+  one multiply.
+*/
+
+#ifndef DEADZONE_H
+#define DEADZONE_H
+
+#include <EEPROM.h>
+#include "config.h"
+
+// EEPROM layout: ... settings at 512, deadzones at 640
+#define EEPROM_DEADZONE_ADDRESS 640
+#define DEADZONE_SIGNATURE 0xDE0A
+
+#define DEADZONE_MAX 200
+#define DEADZONE_HYSTERESIS_MAX 50
+
+enum DeadzoneAxis {
+  DZ_STEERING = 0,    // Right stick X
+  DZ_THROTTLE,        // Left stick Y
+  DZ_RIGHT_Y,         // Right stick Y
+  DZ_LEFT_X,          // Left stick X
+  NUM_DEADZONE_AXES
+};
+
+// Deadzone data stored in EEPROM
+struct DeadzoneData {
+  uint8_t deadzone[NUM_DEADZONE_AXES];   // 0-200 (units of the -1000..+1000 range)
+  uint8_t hysteresis;                    // 0-50, extra travel needed to leave the centre
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+DeadzoneData deadzoneData;
+
+// Compiled per-axis values
+int32_t deadzoneScaleQ16[NUM_DEADZONE_AXES];   // 1000 / (1000 - deadzone - hysteresis) in Q16
+bool deadzoneCentered[NUM_DEADZONE_AXES];      // Hysteresis state
+
+// Function declarations
+void initDeadzones(int legacyDeadzone);
+void saveDeadzones();
+void loadDeadzones(int legacyDeadzone);
+void resetDeadzones(int deadzone);
+void compileDeadzones();
+int applyDeadzone(int axis, int value);
+const char* getDeadzoneAxisName(int axis);
+
+void initDeadzones(int legacyDeadzone) {
+  loadDeadzones(legacyDeadzone);
+  compileDeadzones();
+}
+
+void saveDeadzones() {
+  deadzoneData.signature = DEADZONE_SIGNATURE;
+  EEPROM.put(EEPROM_DEADZONE_ADDRESS, deadzoneData);
+  Serial.println("Deadzones saved to EEPROM");
+}
+
+// Without stored per-axis values every axis starts from the old single deadzone setting
+void loadDeadzones(int legacyDeadzone) {
+  EEPROM.get(EEPROM_DEADZONE_ADDRESS, deadzoneData);
+
+  if (deadzoneData.signature != DEADZONE_SIGNATURE) {
+    Serial.println("No valid deadzones found, using the joystick deadzone setting");
+    resetDeadzones(legacyDeadzone);
+  } else {
+    // The stored bytes are trusted no further than the editor's limits
+    for (int axis = 0; axis < NUM_DEADZONE_AXES; axis++) {
+      deadzoneData.deadzone[axis] = constrain(deadzoneData.deadzone[axis], 0, DEADZONE_MAX);
+    }
+    deadzoneData.hysteresis = constrain(deadzoneData.hysteresis, 0, DEADZONE_HYSTERESIS_MAX);
+    Serial.println("Deadzones loaded from EEPROM");
+  }
+}
+
+void resetDeadzones(int deadzone) {
+  deadzone = constrain(deadzone, 0, DEADZONE_MAX);
+  for (int axis = 0; axis < NUM_DEADZONE_AXES; axis++) {
+    deadzoneData.deadzone[axis] = deadzone;
+  }
+  deadzoneData.hysteresis = 10;
+  deadzoneData.signature = DEADZONE_SIGNATURE;
+}
+
+void compileDeadzones() {
+  for (int axis = 0; axis < NUM_DEADZONE_AXES; axis++) {
+    int edge = deadzoneData.deadzone[axis] + deadzoneData.hysteresis;
+    deadzoneScaleQ16[axis] = (1000L << 16) / (1000 - edge);
+    deadzoneCentered[axis] = true;
+  }
+}
+
+// Per-tick conditioning of one calibrated stick axis
+int applyDeadzone(int axis, int value) {
+  int dz = deadzoneData.deadzone[axis];
+  int edge = dz + deadzoneData.hysteresis;
+  int magnitude = abs(value);
+
+  // Centre hysteresis: leaving the centre needs deadzone + hysteresis, coming back only the deadzone
+  if (magnitude <= (deadzoneCentered[axis] ? edge : dz)) {
+    deadzoneCentered[axis] = true;
+    return 0;
+  }
+  deadzoneCentered[axis] = false;
+  if (magnitude <= edge) return 0;   // On the way back, between the two edges
+
+  // Rescale the travel past the leaving edge to the full range - 0 at the edge, no step
+  int32_t scaled = ((int32_t)(magnitude - edge) * deadzoneScaleQ16[axis] + 0x8000) >> 16;
+  if (scaled > 1000) scaled = 1000;
+  return value < 0 ? -scaled : scaled;
+}
+
+const char* getDeadzoneAxisName(int axis) {
+  switch (axis) {
+    case DZ_STEERING: return "Steering";
+    case DZ_THROTTLE: return "Throttle";
+    case DZ_RIGHT_Y: return "Right Y";
+    case DZ_LEFT_X: return "Left X";
+    default: return "Hysteresis";
+  }
+}
+
+#endif
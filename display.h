@@ -12,6 +12,8 @@
 #include "config.h"
 #include "radio.h"
 #include "controls.h"
+#include "display_flush.h"
+#include "display_numbers.h"
 
 // Forward declare menu functions
 extern bool isMenuActive();
@@ -26,8 +28,8 @@ extern uint32_t getCycleCounter();
 // Forward declare temperature function
 float readCPUTemperature();
 
-// Display object
-Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+// Display object - the bus stays at DISPLAY_I2C_CLOCK between transfers for the async flush
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1, DISPLAY_I2C_CLOCK, DISPLAY_I2C_CLOCK);
 
 // Table position and size variables - adjust these to move/resize the table
 int table_start_x = 10;
@@ -51,15 +53,76 @@ int steer_bar_y = 56;
 int steer_bar_width = 8;
 int steer_bar_length = 118;
 
+// Main screen render slices - one per loop() pass, flushed after the last
+enum MainRenderStage {
+  RENDER_IDLE = 0,
+  RENDER_HEADER,
+  RENDER_BARS,
+  RENDER_TABLE
+};
+
+MainRenderStage mainRenderStage = RENDER_IDLE;
+
+// Static layer - grid, labels, bar outlines and hint of the main screen,
+// rendered once and copied in at the start of every frame
+uint8_t mainStaticLayer[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+bool mainStaticLayerValid = false;
+
+// Everything the main screen shows, captured once per frame. A frame whose
+// model equals the previous one is skipped, up to DISPLAY_MAX_STALE_MS.
+// The raw ADC values only count as changed beyond DISPLAY_RAW_HYSTERESIS,
+// so ADC noise on sticks at rest doesn't redraw every frame.
+struct MainDisplayModel {
+  int16_t throttle;
+  int16_t steering;
+  int16_t rawThrottle;
+  int16_t rawSteering;
+  bool armed;
+  bool radioOK;
+  int16_t temperature;
+  uint32_t cycles;
+  uint32_t packets;
+  uint32_t acks;
+  uint32_t fails;
+};
+
+MainDisplayModel mainModel;
+bool mainModelValid = false;          // False after a menu frame - the next main frame must draw
+unsigned long mainModelTime = 0;
+uint32_t displaySkippedFrames = 0;
+
+// Table cell positions (integer, computed with the static layer)
+int tableCol2X = 0;   // Left edge of the VAL column
+int tableCol3X = 0;   // Left edge of the RAW column
+int tableRowThrY = 0; // Text baseline of the THR row
+int tableRowStrY = 0; // Text baseline of the STR row
+
+// Display budget statistics
+uint32_t displayPasses = 0;           // loop() passes that did display work
+uint32_t displayOverBudget = 0;       // Passes that ran past DISPLAY_BUDGET_US
+uint32_t displayMaxPassMicros = 0;
+uint32_t displayUnitMicros = 0;       // Slowest single render slice / I2C transaction seen
+
 // Function declarations
 void initDisplay();
 void updateDisplay();
+void serviceDisplay();
+bool isDisplayBusy();
+void renderMainDisplaySlice();
+void printDisplayBudgetStats();
+void buildMainStaticLayer();
+void captureMainDisplayModel(MainDisplayModel& model);
+bool isMainModelUnchanged(const MainDisplayModel& model);
 void displayReady();
+void drawThrottleBarOutline();
+void drawSteeringBarOutline();
+void drawValuesTableGrid();
 void drawThrottleBar();
 void drawSteeringBar();
 void drawValuesTable();
 void displayError(const char* message);
-void drawMainDisplay();
+void drawStatusHeader();
+void drawStatusLabels();
 void drawMenuHint();
 
 void initDisplay() {
@@ -67,6 +130,7 @@ void initDisplay() {
   
   // Initialize I2C with Teensy's specific pins
   Wire.begin();
+  Wire.setClock(DISPLAY_I2C_CLOCK);
   
   if(!display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
     Serial.println("FAILED!");
@@ -86,31 +150,167 @@ void initDisplay() {
   Serial.println("SUCCESS!");
 }
 
+// Start a new frame. Menu screens render in one go; the main screen is
+// rendered in slices by serviceDisplay().
 void updateDisplay() {
   // Check if menu is active
   if (isMenuActive()) {
+    mainRenderStage = RENDER_IDLE;
+    mainModelValid = false;
     drawMenu();
     return;
   }
   
-  // Draw normal operating display
-  drawMainDisplay();
+  // Draw normal operating display - only if something on it changed
+  MainDisplayModel model;
+  captureMainDisplayModel(model);
+  if (mainModelValid && isMainModelUnchanged(model) &&
+      millis() - mainModelTime < DISPLAY_MAX_STALE_MS) {
+    displaySkippedFrames++;
+    return;
+  }
+  
+  mainModel = model;
+  mainModelValid = true;
+  mainModelTime = millis();
+  mainRenderStage = RENDER_HEADER;
+}
+
+// Snapshot of the displayed values - the render slices draw from this, so a
+// frame is consistent even though it is rendered over several passes
+void captureMainDisplayModel(MainDisplayModel& model) {
+  memset(&model, 0, sizeof(model));  // Padding must compare equal too
+  model.throttle = data.throttle;
+  model.steering = data.steering;
+  model.rawThrottle = rawThrottleValue;   // Last TX tick - no extra ADC conversions here
+  model.rawSteering = rawSteeringValue;
+  model.armed = getArmedStatus();
+  model.radioOK = isRadioOK();
+  model.temperature = (int)readCPUTemperature();
+  model.cycles = getCycleCounter();
+  model.packets = getTotalPacketsSent();
+  model.acks = getAcksReceived();
+  model.fails = getFailedAcks();
+}
+
+// Compared with the drawn model; raw values within the hysteresis count as equal.
+// A redraw still shows the exact values.
+bool isMainModelUnchanged(const MainDisplayModel& model) {
+  MainDisplayModel compared = model;
+  if (abs(compared.rawThrottle - mainModel.rawThrottle) <= DISPLAY_RAW_HYSTERESIS) {
+    compared.rawThrottle = mainModel.rawThrottle;
+  }
+  if (abs(compared.rawSteering - mainModel.rawSteering) <= DISPLAY_RAW_HYSTERESIS) {
+    compared.rawSteering = mainModel.rawSteering;
+  }
+  return memcmp(&compared, &mainModel, sizeof(compared)) == 0;
 }
 
-void drawMainDisplay() {
+// Display work for one loop() pass: render slices and I2C transactions until
+// the next one would overrun DISPLAY_BUDGET_US. At least one unit always runs.
+// Rendering goes first - it only touches the back buffer, so the next frame
+// is ready by the time the one on the bus has been sent.
+void serviceDisplay() {
+  if (!isDisplayBusy() && !isDisplayFlushBusy()) return;
+  
+  uint32_t start = micros();
+  uint32_t elapsed = 0;
+  do {
+    uint32_t unitStart = micros();
+    if (mainRenderStage != RENDER_IDLE) {
+      renderMainDisplaySlice();
+    } else {
+      updateDisplayFlush();
+    }
+    uint32_t unit = micros() - unitStart;
+    if (unit > displayUnitMicros) displayUnitMicros = unit;
+    elapsed = micros() - start;
+  } while ((isDisplayBusy() || isDisplayFlushBusy()) &&
+           elapsed + displayUnitMicros <= DISPLAY_BUDGET_US);
+  
+  displayPasses++;
+  if (elapsed > DISPLAY_BUDGET_US) displayOverBudget++;
+  if (elapsed > displayMaxPassMicros) displayMaxPassMicros = elapsed;
+}
+
+// True while the back buffer is in use - a new frame has to wait. The flush
+// of the previous frame may still be running, it sends from its own copy.
+bool isDisplayBusy() {
+  return mainRenderStage != RENDER_IDLE || isDisplayFramePending();
+}
+
+void renderMainDisplaySlice() {
+  switch (mainRenderStage) {
+    case RENDER_HEADER:
+      if (!mainStaticLayerValid) buildMainStaticLayer();
+      memcpy(display.getBuffer(), mainStaticLayer, sizeof(mainStaticLayer));
+      
+      // === YELLOW AREA (0-15 pixels) ===
+      drawStatusHeader();
+      mainRenderStage = RENDER_BARS;
+      break;
+    case RENDER_BARS:
+      // === BLUE AREA (16-63 pixels) ===
+      drawThrottleBar();
+      drawSteeringBar();
+      mainRenderStage = RENDER_TABLE;
+      break;
+    case RENDER_TABLE:
+      drawValuesTable();
+      requestDisplayFlush();
+      mainRenderStage = RENDER_IDLE;
+      break;
+    default:
+      mainRenderStage = RENDER_IDLE;
+      break;
+  }
+}
+
+void printDisplayBudgetStats() {
+  Serial.print("Display passes: ");
+  Serial.print(displayPasses);
+  Serial.print(" Over budget (");
+  Serial.print(DISPLAY_BUDGET_US);
+  Serial.print(" us): ");
+  Serial.print(displayOverBudget);
+  Serial.print(" Max pass: ");
+  Serial.print(displayMaxPassMicros);
+  Serial.print(" us Slowest unit: ");
+  Serial.print(displayUnitMicros);
+  Serial.print(" us Unchanged frames skipped: ");
+  Serial.println(displaySkippedFrames);
+  
+  displayPasses = 0;
+  displaySkippedFrames = 0;
+  displayOverBudget = 0;
+  displayMaxPassMicros = 0;
+  displayUnitMicros = 0;
+}
+
+// Render the static chrome into the framebuffer once and keep a copy
+void buildMainStaticLayer() {
   display.clearDisplay();
-  
-  // === YELLOW AREA (0-15 pixels) ===
+  drawThrottleBarOutline();
+  drawSteeringBarOutline();
+  drawValuesTableGrid();
+  drawStatusLabels();
+  drawMenuHint();
+  memcpy(mainStaticLayer, display.getBuffer(), sizeof(mainStaticLayer));
+  mainStaticLayerValid = true;
+}
+
+// Status rows in the yellow area
+void drawStatusHeader() {
   display.setTextSize(1);
   display.setCursor(0, 0);
   
   // First row: RC TX status, armed status, and cycle counter
   display.print("TX:");
-  display.print(isRadioOK() ? "ON" : "OFF");
+  display.print(mainModel.radioOK ? "ON" : "OFF");
   display.print("|");
   
   // Armed status with special formatting
-  if (getArmedStatus()) {
+  if (mainModel.armed) {
     // ARMED: White background, black text
     int armedTextX = display.getCursorX();
     int armedTextY = display.getCursorY();
@@ -131,33 +331,26 @@ void drawMainDisplay() {
   
   // Add cycle counter and CPU temperature
   display.print("-C:");
-  display.print(getCycleCounter());
+  display.print(mainModel.cycles);
   display.print("|T:");
-  display.print((int)readCPUTemperature());
+  display.print(mainModel.temperature);
 
   
-  // Second row: Packet statistics with ACK tracking
+  // Second row: Packet statistics with ACK tracking (labels are in the static layer)
+  drawFixedNumber(12, 8, mainModel.packets, 4);
+  drawFixedNumber(54, 8, mainModel.acks, 4);
+  drawFixedNumber(96, 8, mainModel.fails, 4);
+}
+
+// Fixed labels of the packet row - the counters are 4 digit fields (reset at 9999)
+void drawStatusLabels() {
+  display.setTextSize(1);
   display.setCursor(0, 8);
   display.print("P:");
-  display.print(getTotalPacketsSent());
+  display.setCursor(36, 8);
   display.print("|A:");
-  display.print(getAcksReceived());
+  display.setCursor(78, 8);
   display.print("|F:");
-  display.print(getFailedAcks());
-  
-  // === BLUE AREA (16-63 pixels) ===
-  
-  // Draw control bars
-  drawThrottleBar();
-  drawSteeringBar();
-  
-  // Values table - organized layout
-  drawValuesTable();
-  
-  // Draw menu hint at bottom
-  drawMenuHint();
-  
-  display.display();
 }
 
 void drawMenuHint() {
@@ -167,63 +360,68 @@ void drawMenuHint() {
   display.print("Hold OK");
 }
 
-void drawThrottleBar() {
+void drawThrottleBarOutline() {
   // Vertical bar positioned and sized using adjustable variables
+  display.drawRect(throttle_bar_x, throttle_bar_y, throttle_bar_width, throttle_bar_length, SSD1306_WHITE);
+  
+  // Center line
+  int centerY = throttle_bar_y + throttle_bar_length / 2;
+  display.drawLine(throttle_bar_x, centerY, throttle_bar_x + throttle_bar_width - 1, centerY, SSD1306_WHITE);
+}
+
+void drawSteeringBarOutline() {
+  // Horizontal bar positioned and sized using adjustable variables
+  display.drawRect(steer_bar_x, steer_bar_y, steer_bar_length, steer_bar_width, SSD1306_WHITE);
+  
+  // Center line
+  int centerX = steer_bar_x + steer_bar_length / 2;
+  display.drawLine(centerX, steer_bar_y, centerX, steer_bar_y + steer_bar_width - 1, SSD1306_WHITE);
+}
+
+// Fill only - the outline and center line come from the static layer
+void drawThrottleBar() {
   int barX = throttle_bar_x;
   int barY = throttle_bar_y;
   int barWidth = throttle_bar_width;
   int barHeight = throttle_bar_length;
   
-  // Draw outline
-  display.drawRect(barX, barY, barWidth, barHeight, SSD1306_WHITE);
-  
   // Calculate fill height based on throttle value
-  int fillHeight = map(abs(data.throttle), 0, 1000, 0, barHeight / 2 - 1);
+  int fillHeight = map(abs(mainModel.throttle), 0, 1000, 0, barHeight / 2 - 1);
   
-  if (data.throttle > 0) {
+  if (mainModel.throttle > 0) {
     // Forward - fill from center up
     int fillY = barY + (barHeight / 2) - fillHeight;
     display.fillRect(barX + 1, fillY, barWidth - 2, fillHeight, SSD1306_WHITE);
-  } else if (data.throttle < 0) {
+  } else if (mainModel.throttle < 0) {
     // Reverse - fill from center down
     int fillY = barY + (barHeight / 2);
     display.fillRect(barX + 1, fillY, barWidth - 2, fillHeight, SSD1306_WHITE);
   }
-  
-  // Center line
-  int centerY = barY + barHeight / 2;
-  display.drawLine(barX, centerY, barX + barWidth - 1, centerY, SSD1306_WHITE);
 }
 
+// Fill only - the outline and center line come from the static layer
 void drawSteeringBar() {
-  // Horizontal bar positioned and sized using adjustable variables
   int barX = steer_bar_x;
   int barY = steer_bar_y;
   int barWidth = steer_bar_length;
   int barHeight = steer_bar_width;
   
-  // Draw outline
-  display.drawRect(barX, barY, barWidth, barHeight, SSD1306_WHITE);
-  
   // Calculate fill width based on steering value
-  int fillWidth = map(abs(data.steering), 0, 1000, 0, barWidth / 2 - 1);
+  int fillWidth = map(abs(mainModel.steering), 0, 1000, 0, barWidth / 2 - 1);
   
-  if (data.steering > 0) {
+  if (mainModel.steering > 0) {
     // Right - fill from center right
     int fillX = barX + (barWidth / 2);
     display.fillRect(fillX, barY + 1, fillWidth, barHeight - 2, SSD1306_WHITE);
-  } else if (data.steering < 0) {
+  } else if (mainModel.steering < 0) {
     // Left - fill from center left
     int fillX = barX + (barWidth / 2) - fillWidth;
     display.fillRect(fillX, barY + 1, fillWidth, barHeight - 2, SSD1306_WHITE);
   }
-  
-  // Center line
-  int centerX = barX + barWidth / 2;
-  display.drawLine(centerX, barY, centerX, barY + barHeight - 1, SSD1306_WHITE);
 }
 
 void displayReady() {
+  finishDisplayFlush();
   display.clearDisplay();
   display.setTextSize(1);
   display.setCursor(0, 0);
@@ -236,10 +434,12 @@ void displayReady() {
   display.println("Left Joy Y = Throttle");
   display.println("ACK System: ENABLED");
   display.display();
+  invalidateDisplayShadow();
   delay(2000); // Show for 2 seconds
 }
 
-void drawValuesTable() {
+// Outline, separators, header and row labels - also fixes the cell positions
+void drawValuesTableGrid() {
   // Table positioned and sized using adjustable variables
   int tableX = table_start_x;
   int tableY = table_start_y;
@@ -250,15 +450,18 @@ void drawValuesTable() {
   display.drawRect(tableX, tableY, tableWidth, tableHeight, SSD1306_WHITE);
   
   // Column and row dimensions (for positioning text and lines)
-  int col1Width = tableWidth * 0.26;  // ~31px for "THR"/"STR"
-  int col2Width = tableWidth * 0.38;  // ~45px for values
-  int col3Width = tableWidth * 0.36;  // ~42px for raw values
-  int headerHeight = tableHeight * 0.33;  // ~13px
-  int rowHeight = tableHeight * 0.33;     // ~13px
+  int col1Width = tableWidth * 26 / 100;  // ~31px for "THR"/"STR"
+  int col2Width = tableWidth * 38 / 100;  // ~45px for values
+  int rowHeight = tableHeight * 33 / 100; // ~13px, header row too
+  
+  tableCol2X = tableX + col1Width;
+  tableCol3X = tableX + col1Width + col2Width;
+  tableRowThrY = tableY + rowHeight + table_text_offset_y;
+  tableRowStrY = tableY + 2 * rowHeight + table_text_offset_y;
   
   // Draw vertical column separators
-  display.drawLine(tableX + col1Width, tableY, tableX + col1Width, tableY + tableHeight - 1, SSD1306_WHITE);
-  display.drawLine(tableX + col1Width + col2Width, tableY, tableX + col1Width + col2Width, tableY + tableHeight - 1, SSD1306_WHITE);
+  display.drawLine(tableCol2X, tableY, tableCol2X, tableY + tableHeight - 1, SSD1306_WHITE);
+  display.drawLine(tableCol3X, tableY, tableCol3X, tableY + tableHeight - 1, SSD1306_WHITE);
   
   // Set text size
   display.setTextSize(1);
@@ -266,35 +469,39 @@ void drawValuesTable() {
   // Header row
   display.setCursor(tableX + table_text_offset_x, tableY + table_text_offset_y);
   display.print("#");
-  display.setCursor(tableX + col1Width + table_text_offset_x + 3, tableY + table_text_offset_y);
+  display.setCursor(tableCol2X + table_text_offset_x + 3, tableY + table_text_offset_y);
   display.print("VAL");
-  display.setCursor(tableX + col1Width + col2Width + table_text_offset_x + 2, tableY + table_text_offset_y);
+  display.setCursor(tableCol3X + table_text_offset_x + 2, tableY + table_text_offset_y);
   display.print("RAW");
   
-  // THR row
-  display.setCursor(tableX + table_text_offset_x, tableY + headerHeight + table_text_offset_y);
+  // Row labels
+  display.setCursor(tableX + table_text_offset_x, tableRowThrY);
   display.print("THR");
-  display.setCursor(tableX + col1Width + table_text_offset_x, tableY + headerHeight + table_text_offset_y);
-  display.print(data.throttle);
-  display.setCursor(tableX + col1Width + col2Width + table_text_offset_x, tableY + headerHeight + table_text_offset_y);
-  display.print(analogRead(LEFT_JOY_Y));
+  display.setCursor(tableX + table_text_offset_x, tableRowStrY);
+  display.print("STR");
+}
+
+// Values only - the grid and labels come from the static layer.
+// Right-aligned fixed fields: VAL fits -1000, RAW fits 4095
+void drawValuesTable() {
+  // THR row
+  drawFixedNumber(tableCol2X + table_text_offset_x, tableRowThrY, mainModel.throttle, 5);
+  drawFixedNumber(tableCol3X + table_text_offset_x, tableRowThrY, mainModel.rawThrottle, 4);
   
   // STR row
-  display.setCursor(tableX + table_text_offset_x, tableY + headerHeight + rowHeight + table_text_offset_y);
-  display.print("STR");
-  display.setCursor(tableX + col1Width + table_text_offset_x, tableY + headerHeight + rowHeight + table_text_offset_y);
-  display.print(data.steering);
-  display.setCursor(tableX + col1Width + col2Width + table_text_offset_x, tableY + headerHeight + rowHeight + table_text_offset_y);
-  display.print(analogRead(RIGHT_JOY_X));
+  drawFixedNumber(tableCol2X + table_text_offset_x, tableRowStrY, mainModel.steering, 5);
+  drawFixedNumber(tableCol3X + table_text_offset_x, tableRowStrY, mainModel.rawSteering, 4);
 }
 
 void displayError(const char* message) {
+  finishDisplayFlush();
   display.clearDisplay();
   display.setTextSize(1);
   display.setCursor(0, 0);
   display.println("ERROR:");
   display.println(message);
   display.display();
+  invalidateDisplayShadow();
 }
 
 // Teensy 4.0 CPU Temperature Reading Function
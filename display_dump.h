@@ -0,0 +1,140 @@
+/*
+  display_dump.h - Screen Dump over Serial
+  RC Transmitter for Teensy 4.0
+
+  UI changes are tested on the host (tests/render_test.cpp renders every
+  screen against tests/golden/). This is the on-device counterpart, to
+  check the real panel and timing: build with USE_SCREEN_DUMP 1
+  (config.h) and at the end of setup() every screen that can be drawn
+  without side effects is rendered once - the main screen, each list
+  menu and the factory reset dialogs. Each screen is printed as a plain
+  PBM image (P1) between "--- SCREEN <name> ---" and "--- END SCREEN ---"
+  markers, followed by the render time and a CRC32 of the framebuffer.
+
+  The images use the same layout as the golden files, so a screen cut
+  from the log can be diffed against them. The main screen and the menus
+  that show live values (calibration, free RAM) are expected to differ.
+
+  Editors, calibration and the radio/display/button tests are skipped.
+  Opening them starts the real thing - the stored value is edited, a
+  calibration begins, or the radio is keyed.
+*/
+
+#ifndef DISPLAY_DUMP_H
+#define DISPLAY_DUMP_H
+
+#include <Adafruit_SSD1306.h>
+#include "config.h"
+#include "display.h"
+#include "menu.h"
+
+extern Adafruit_SSD1306 display;
+
+// Function declarations
+void dumpAllScreens();
+void dumpMainScreen();
+void dumpMenuScreen(int state, const char* name);
+void printScreenDump(const char* name, uint32_t renderMicros);
+uint32_t crc32Framebuffer();
+
+void dumpAllScreens() {
+  Serial.println("=== Screen dump ===");
+  int screens = 0;
+
+  dumpMainScreen();
+  screens++;
+
+  for (int state = MENU_MAIN; state < MENU_STATE_COUNT; state++) {
+    const MenuNode& node = getMenuNode(state);
+    if (node.enter) continue;                       // Starts a test or the reset
+    if (!node.items) continue;                      // Editor or live screen
+
+    if (node.header) {
+      dumpMenuScreen(state, node.header);
+    } else if (node.headerStatus) {
+      dumpMenuScreen(state, node.headerStatus(0));
+    } else {
+      dumpMenuScreen(state, state == MENU_FACTORY_RESET_CONFIRM ? "Factory Reset" : "Factory Reset Final");
+    }
+    screens++;
+  }
+
+  setCurrentMenu(MENU_HIDDEN);
+  mainModelValid = false;
+  finishDisplayFlush();
+
+  Serial.print("=== ");
+  Serial.print(screens);
+  Serial.println(" screens dumped ===");
+}
+
+// The main screen through its normal render slices
+void dumpMainScreen() {
+  finishDisplayFlush();
+  setCurrentMenu(MENU_HIDDEN);
+  mainModelValid = false;
+  readJoysticks();                                  // RAW column shows the last tick's readings
+
+  uint32_t start = micros();
+  updateDisplay();
+  while (mainRenderStage != RENDER_IDLE) {
+    renderMainDisplaySlice();
+  }
+  printScreenDump("Main", micros() - start);
+}
+
+void dumpMenuScreen(int state, const char* name) {
+  finishDisplayFlush();
+  setCurrentMenu(state);
+
+  uint32_t start = micros();
+  drawMenu();
+  printScreenDump(name, micros() - start);
+}
+
+// Framebuffer as PBM - 1 = black, so the image looks like the panel
+void printScreenDump(const char* name, uint32_t renderMicros) {
+  const uint8_t* buffer = display.getBuffer();
+  char line[SCREEN_WIDTH / 2 + 1];                  // PBM lines should stay under 70 characters
+
+  Serial.print("--- SCREEN ");
+  Serial.print(name);
+  Serial.println(" ---");
+  Serial.println("P1");
+  Serial.print(SCREEN_WIDTH);
+  Serial.print(" ");
+  Serial.println(SCREEN_HEIGHT);
+
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    const uint8_t* row = buffer + (y / 8) * SCREEN_WIDTH;
+    uint8_t bit = 1 << (y & 7);
+    for (int half = 0; half < 2; half++) {
+      for (int i = 0; i < SCREEN_WIDTH / 2; i++) {
+        line[i] = (row[half * SCREEN_WIDTH / 2 + i] & bit) ? '0' : '1';
+      }
+      line[SCREEN_WIDTH / 2] = '\0';
+      Serial.println(line);
+    }
+  }
+  Serial.println("--- END SCREEN ---");
+
+  Serial.print("Render: ");
+  Serial.print(renderMicros);
+  Serial.print(" us CRC32: ");
+  Serial.println(crc32Framebuffer(), HEX);
+}
+
+// Bitwise CRC-32 (IEEE) - slow, but only runs for the dump
+uint32_t crc32Framebuffer() {
+  const uint8_t* buffer = display.getBuffer();
+  uint32_t crc = 0xFFFFFFFF;
+  for (int i = 0; i < SCREEN_WIDTH * DISPLAY_PAGES; i++) {
+    crc ^= buffer[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0u - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+#endif
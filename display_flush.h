@@ -0,0 +1,235 @@
+/*
+  display_flush.h - Non-Blocking SSD1306 Framebuffer Flush
+  RC Transmitter for Teensy 4.0
+
+  display.display() pushes the whole 1 KB framebuffer in one blocking
+  Wire transfer, which is longer than a TX interval. Here the flush is a
+  small state machine instead: every updateDisplayFlush() call sends one
+  I2C transaction - either the address window of the next page or
+  DISPLAY_FLUSH_CHUNK data bytes of it. serviceDisplay() (display.h) runs
+  as many as fit the per-pass DISPLAY_BUDGET_US, so the radio tick keeps
+  its cadence.
+
+  The flush streams from its own front buffer. requestDisplayFlush()
+  presents the Adafruit framebuffer (the back buffer) by copying it to the
+  front - 1 KB, about a microsecond - so the next frame can be rendered
+  while this one is still on the bus. If a frame is requested while the
+  front buffer is still being sent it is queued and presented as soon as
+  that flush ends; the back buffer must not be redrawn until then
+  (isDisplayFramePending()).
+
+  Only what changed is sent: a shadow copy holds what the panel shows,
+  and each page is narrowed to the column span that differs from it
+  (clean pages are skipped). Static chrome therefore costs no bus time.
+*/
+
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+#include "config.h"
+
+#define DISPLAY_I2C_CLOCK 400000      // Fast-mode I2C (SSD1306 maximum)
+#define DISPLAY_FLUSH_CHUNK 16        // Data bytes per transaction (fits the 32 byte Wire buffer)
+#define DISPLAY_PAGES (SCREEN_HEIGHT / 8)
+
+// SSD1306 control bytes
+#define SSD1306_CONTROL_COMMAND 0x00
+#define SSD1306_CONTROL_DATA 0x40
+
+enum DisplayFlushState {
+  FLUSH_IDLE = 0,
+  FLUSH_ADDRESS,                      // Next transaction sets the page/column window
+  FLUSH_DATA                          // Next transaction sends page data
+};
+
+extern Adafruit_SSD1306 display;
+
+DisplayFlushState flushState = FLUSH_IDLE;
+uint8_t flushPage = 0;
+uint8_t flushColumn = 0;
+
+// Frame being sent, and whether the back buffer holds a finished frame waiting for it
+uint8_t flushFrontBuffer[SCREEN_WIDTH * DISPLAY_PAGES];
+bool flushFramePending = false;
+
+// Panel contents as last sent, and the dirty column span of each page (start > end = clean)
+uint8_t flushShadow[SCREEN_WIDTH * DISPLAY_PAGES];
+bool flushShadowValid = false;
+uint8_t flushSpanStart[DISPLAY_PAGES];
+uint8_t flushSpanEnd[DISPLAY_PAGES];
+
+// Flush statistics
+uint32_t flushFrames = 0;
+uint32_t flushCleanFrames = 0;        // Frames identical to the panel - nothing sent
+uint32_t flushQueuedFrames = 0;       // Frames rendered while the previous one was still sending
+uint32_t flushBytes = 0;
+uint32_t flushMaxSliceMicros = 0;     // Longest single updateDisplayFlush() call
+uint32_t flushStatsStart = 0;
+
+// Function declarations
+void requestDisplayFlush();
+void presentDisplayFrame();
+bool findDirtySpan(int page);
+bool advanceFlushPage(int page);
+void invalidateDisplayShadow();
+void updateDisplayFlush();
+void finishDisplayFlush();
+bool isDisplayFlushBusy();
+bool isDisplayFramePending();
+void sendDisplayCommands(const uint8_t* commands, int count);
+void printDisplayFlushStats();
+
+// Present the finished back buffer - now, or when the current flush ends
+void requestDisplayFlush() {
+  if (flushState != FLUSH_IDLE) {
+    flushFramePending = true;
+    flushQueuedFrames++;
+    return;
+  }
+  presentDisplayFrame();
+}
+
+// Copy the back buffer to the front and start streaming what differs from the panel
+void presentDisplayFrame() {
+  memcpy(flushFrontBuffer, display.getBuffer(), sizeof(flushFrontBuffer));
+  flushFramePending = false;
+  
+  bool dirty = false;
+  for (int page = 0; page < DISPLAY_PAGES; page++) {
+    dirty |= findDirtySpan(page);
+  }
+  flushShadowValid = true;
+
+  if (!dirty) {
+    flushState = FLUSH_IDLE;
+    flushCleanFrames++;
+    return;
+  }
+  advanceFlushPage(0);
+}
+
+// Narrow one page to its first..last changed column
+bool findDirtySpan(int page) {
+  const uint8_t* buffer = flushFrontBuffer + page * SCREEN_WIDTH;
+  const uint8_t* shadow = flushShadow + page * SCREEN_WIDTH;
+
+  int first = 0;
+  int last = SCREEN_WIDTH - 1;
+  if (flushShadowValid) {
+    while (first < SCREEN_WIDTH && buffer[first] == shadow[first]) first++;
+    while (last > first && buffer[last] == shadow[last]) last--;
+  }
+
+  if (first >= SCREEN_WIDTH) {
+    flushSpanStart[page] = 1;  // Clean
+    flushSpanEnd[page] = 0;
+    return false;
+  }
+  flushSpanStart[page] = first;
+  flushSpanEnd[page] = last;
+  return true;
+}
+
+// Move to the next dirty page at or after page; false when the frame is done
+bool advanceFlushPage(int page) {
+  while (page < DISPLAY_PAGES && flushSpanStart[page] > flushSpanEnd[page]) page++;
+  if (page >= DISPLAY_PAGES) {
+    flushState = FLUSH_IDLE;
+    flushFrames++;
+    if (flushFramePending) presentDisplayFrame();  // Swap in the queued frame
+    return false;
+  }
+  flushPage = page;
+  flushState = FLUSH_ADDRESS;
+  return true;
+}
+
+// The panel was written behind our back (blocking display()) - resend everything next time
+void invalidateDisplayShadow() {
+  flushShadowValid = false;
+}
+
+// One I2C transaction of the pending flush
+void updateDisplayFlush() {
+  if (flushState == FLUSH_IDLE) return;
+  uint32_t start = micros();
+
+  if (flushState == FLUSH_ADDRESS) {
+    const uint8_t window[] = {
+      SSD1306_PAGEADDR, flushPage, flushPage,
+      SSD1306_COLUMNADDR, flushSpanStart[flushPage], flushSpanEnd[flushPage]
+    };
+    sendDisplayCommands(window, sizeof(window));
+    flushBytes += sizeof(window) + 1;
+    flushColumn = flushSpanStart[flushPage];
+    flushState = FLUSH_DATA;
+  } else {
+    int offset = flushPage * SCREEN_WIDTH + flushColumn;
+    int count = min(DISPLAY_FLUSH_CHUNK, flushSpanEnd[flushPage] + 1 - flushColumn);
+
+    Wire.beginTransmission(SCREEN_ADDRESS);
+    Wire.write(SSD1306_CONTROL_DATA);
+    Wire.write(flushFrontBuffer + offset, count);
+    Wire.endTransmission();
+    memcpy(flushShadow + offset, flushFrontBuffer + offset, count);
+    flushColumn += count;
+    flushBytes += count + 1;
+
+    if (flushColumn > flushSpanEnd[flushPage]) {
+      advanceFlushPage(flushPage + 1);
+    }
+  }
+
+  uint32_t elapsed = micros() - start;
+  if (elapsed > flushMaxSliceMicros) flushMaxSliceMicros = elapsed;
+}
+
+// Blocking drain, queued frame included - for screens shown outside the loop() cadence
+void finishDisplayFlush() {
+  while (flushState != FLUSH_IDLE) {
+    updateDisplayFlush();
+  }
+}
+
+bool isDisplayFlushBusy() {
+  return flushState != FLUSH_IDLE;
+}
+
+// True while the back buffer holds a frame not yet copied to the front
+bool isDisplayFramePending() {
+  return flushFramePending;
+}
+
+void sendDisplayCommands(const uint8_t* commands, int count) {
+  Wire.beginTransmission(SCREEN_ADDRESS);
+  Wire.write(SSD1306_CONTROL_COMMAND);
+  Wire.write(commands, count);
+  Wire.endTransmission();
+}
+
+// Counters since the previous report, then restart them
+void printDisplayFlushStats() {
+  uint32_t elapsed = millis() - flushStatsStart;
+  Serial.print("Display frames: ");
+  Serial.print(flushFrames);
+  Serial.print(" (unchanged: ");
+  Serial.print(flushCleanFrames);
+  Serial.print(", queued behind a flush: ");
+  Serial.print(flushQueuedFrames);
+  Serial.print(") I2C: ");
+  Serial.print(elapsed ? (uint32_t)((uint64_t)flushBytes * 1000 / elapsed) : 0);
+  Serial.print(" bytes/s Max slice: ");
+  Serial.print(flushMaxSliceMicros);
+  Serial.println(" us");
+
+  flushFrames = 0;
+  flushCleanFrames = 0;
+  flushQueuedFrames = 0;
+  flushBytes = 0;
+  flushMaxSliceMicros = 0;
+  flushStatsStart = millis();
+}
+
+#endif
@@ -0,0 +1,195 @@
+/*
+  display_numbers.h - Fast Fixed-Width Number Renderer
+  RC Transmitter for Teensy 4.0
+
+  display.print(int) formats through the Print stack and then plots every
+  glyph pixel by pixel in drawChar(). The numbers on the main screen only
+  ever need the 5x7 digits, so here they are written straight into the
+  SSD1306 page buffer as column bytes: one byte per column when the text
+  row is page aligned (y multiple of 8), a masked write into two pages
+  otherwise. Values are right-aligned into a fixed number of character
+  cells and the cells are cleared, so a field never shifts or leaves
+  stale digits behind when its value gets shorter.
+
+  The glyphs are the ones of the built-in GFX font, so the output is pixel
+  identical to display.print() at text size 1. benchmarkNumberRenderer()
+  checks that and times both paths (run from the display test).
+*/
+
+#ifndef DISPLAY_NUMBERS_H
+#define DISPLAY_NUMBERS_H
+
+#include <Adafruit_SSD1306.h>
+#include "config.h"
+
+#define NUMBER_CELL_WIDTH 6           // 5 glyph columns + 1 spacing, same as GFX text size 1
+#define NUMBER_FIELD_MAX 11           // "-2147483648"
+
+#define GLYPH_MINUS 10
+#define GLYPH_OVERFLOW 11             // Field filled with '*' when the value does not fit
+#define GLYPH_BLANK 0xFF
+
+#define NUMBER_BENCH_ROUNDS 200
+
+// Column bytes (bit 0 = top row) from the GFX 5x7 font: '0'-'9', '-', '*'
+const uint8_t numberGlyphs[12][5] = {
+  {0x3E, 0x51, 0x49, 0x45, 0x3E},
+  {0x00, 0x42, 0x7F, 0x40, 0x00},
+  {0x72, 0x49, 0x49, 0x49, 0x46},
+  {0x21, 0x41, 0x49, 0x4D, 0x33},
+  {0x18, 0x14, 0x12, 0x7F, 0x10},
+  {0x27, 0x45, 0x45, 0x45, 0x39},
+  {0x3C, 0x4A, 0x49, 0x49, 0x31},
+  {0x41, 0x21, 0x11, 0x09, 0x07},
+  {0x36, 0x49, 0x49, 0x49, 0x36},
+  {0x46, 0x49, 0x49, 0x29, 0x1E},
+  {0x08, 0x08, 0x08, 0x08, 0x08},
+  {0x08, 0x2A, 0x1C, 0x2A, 0x08}
+};
+
+extern Adafruit_SSD1306 display;
+
+// Function declarations
+void drawFixedNumber(int x, int y, int32_t value, uint8_t width);
+bool layoutNumberField(int32_t value, uint8_t* cells, uint8_t width);
+uint8_t countNumberCells(int32_t value);
+void writeGlyphColumn(int x, int y, uint8_t bits);
+void benchmarkNumberRenderer();
+
+// Right-align value into width character cells at (x, y) = top left, like setCursor()
+void drawFixedNumber(int x, int y, int32_t value, uint8_t width) {
+  if (width > NUMBER_FIELD_MAX) width = NUMBER_FIELD_MAX;
+  if (y < 0 || y > SCREEN_HEIGHT - 8) return;  // Whole rows only
+
+  uint8_t cells[NUMBER_FIELD_MAX];
+  if (!layoutNumberField(value, cells, width)) {
+    memset(cells, GLYPH_OVERFLOW, width);
+  }
+
+  for (int cell = 0; cell < width; cell++) {
+    const uint8_t* glyph = cells[cell] == GLYPH_BLANK ? NULL : numberGlyphs[cells[cell]];
+    for (int column = 0; column < NUMBER_CELL_WIDTH; column++) {
+      uint8_t bits = (glyph && column < 5) ? glyph[column] : 0;
+      writeGlyphColumn(x + cell * NUMBER_CELL_WIDTH + column, y, bits);
+    }
+  }
+}
+
+// Glyph indices, right-aligned and blank padded; false if the value does not fit
+bool layoutNumberField(int32_t value, uint8_t* cells, uint8_t width) {
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  int pos = width;
+
+  do {
+    if (pos == 0) return false;
+    cells[--pos] = magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude);
+
+  if (value < 0) {
+    if (pos == 0) return false;
+    cells[--pos] = GLYPH_MINUS;
+  }
+  while (pos > 0) cells[--pos] = GLYPH_BLANK;
+  return true;
+}
+
+// Characters display.print() would produce for value
+uint8_t countNumberCells(int32_t value) {
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  uint8_t count = value < 0 ? 2 : 1;
+  while (magnitude >= 10) {
+    magnitude /= 10;
+    count++;
+  }
+  return count;
+}
+
+// One 8 pixel column with its top at y - replaces what was there
+void writeGlyphColumn(int x, int y, uint8_t bits) {
+  if (x < 0 || x >= SCREEN_WIDTH) return;
+  uint8_t* column = display.getBuffer() + (y >> 3) * SCREEN_WIDTH + x;
+  int shift = y & 7;
+
+  if (shift == 0) {
+    *column = bits;  // Page aligned row - a single byte store
+    return;
+  }
+
+  // Row straddles two pages: low part of the upper page, high part of the lower page
+  uint8_t upperMask = 0xFF << shift;
+  uint8_t lowerMask = 0xFF >> (8 - shift);
+  column[0] = (column[0] & ~upperMask) | (bits << shift);
+  column[SCREEN_WIDTH] = (column[SCREEN_WIDTH] & ~lowerMask) | (bits >> (8 - shift));
+}
+
+// Pixel check against display.print(), then timing of both renderers on Serial
+void benchmarkNumberRenderer() {
+  const int32_t values[] = {0, 7, -1, 42, -256, 1000, -1000, 4095, 9999, -32768, 123456789};
+  const int valueCount = sizeof(values) / sizeof(values[0]);
+  const int rows[] = {8, 31, 43};   // Page aligned header row and the two table rows
+  static uint8_t reference[SCREEN_WIDTH * (SCREEN_HEIGHT / 8)];
+
+  Serial.println("--- Number Renderer Benchmark ---");
+
+  // Same pixels as GFX: a field exactly as wide as the value is left-aligned too
+  int mismatches = 0;
+  for (int r = 0; r < 3; r++) {
+    for (int i = 0; i < valueCount; i++) {
+      display.clearDisplay();
+      display.setTextSize(1);
+      display.setTextColor(SSD1306_WHITE);
+      display.setCursor(20, rows[r]);
+      display.print(values[i]);
+      memcpy(reference, display.getBuffer(), sizeof(reference));
+
+      display.clearDisplay();
+      drawFixedNumber(20, rows[r], values[i], countNumberCells(values[i]));
+      if (memcmp(reference, display.getBuffer(), sizeof(reference)) != 0) {
+        mismatches++;
+        Serial.print("Pixel mismatch: ");
+        Serial.print(values[i]);
+        Serial.print(" at y=");
+        Serial.println(rows[r]);
+      }
+    }
+  }
+  Serial.print("Pixel check: ");
+  Serial.println(mismatches == 0 ? "identical to GFX print" : "MISMATCH");
+
+  // Four table fields per frame, as on the main screen
+  for (int r = 0; r < 3; r++) {
+    display.clearDisplay();
+    uint32_t start = micros();
+    for (int round = 0; round < NUMBER_BENCH_ROUNDS; round++) {
+      for (int field = 0; field < 4; field++) {
+        display.setCursor(field * 32, rows[r]);
+        display.print(values[(round + field) % 7]);
+      }
+    }
+    uint32_t gfxMicros = micros() - start;
+
+    display.clearDisplay();
+    start = micros();
+    for (int round = 0; round < NUMBER_BENCH_ROUNDS; round++) {
+      for (int field = 0; field < 4; field++) {
+        drawFixedNumber(field * 32, rows[r], values[(round + field) % 7], 5);
+      }
+    }
+    uint32_t fastMicros = micros() - start;
+
+    Serial.print("y=");
+    Serial.print(rows[r]);
+    Serial.print((rows[r] & 7) ? " (unaligned)" : " (aligned)  ");
+    Serial.print(" GFX print: ");
+    Serial.print((float)gfxMicros / (NUMBER_BENCH_ROUNDS * 4), 2);
+    Serial.print(" us/field  Fixed: ");
+    Serial.print((float)fastMicros / (NUMBER_BENCH_ROUNDS * 4), 2);
+    Serial.print(" us/field  x");
+    Serial.println(fastMicros ? (float)gfxMicros / fastMicros : 0, 1);
+  }
+
+  display.clearDisplay();
+}
+
+#endif
@@ -54,6 +54,8 @@ void startDisplayTest() {
   displayTestStepTime = millis();
   buttonCheckEnabled = false;  // Disable button checking initially
   
+  benchmarkNumberRenderer();  // Uses the framebuffer - the test patterns redraw it
+  
   Serial.println("Display test will cycle through 8 test patterns");
   Serial.println("Wait 0.5 seconds, then any button will exit test");
 }
@@ -69,24 +71,17 @@ void updateDisplayTest() {
   
   // Check for any button press to exit early (only after delay)
   if (buttonCheckEnabled) {
-    extern ButtonStates buttons;
-    if (buttons.btnOK || buttons.btnLeft || buttons.btnRight || 
-        buttons.btnUp || buttons.btnDown || buttons.leftJoyBtn || 
-        buttons.rightJoyBtn) {
+    const uint16_t exitButtons = BUTTON_MASK(BTN_OK) | BUTTON_MASK(BTN_LEFT) | BUTTON_MASK(BTN_RIGHT) |
+                                 BUTTON_MASK(BTN_UP) | BUTTON_MASK(BTN_DOWN) | BUTTON_MASK(BTN_LEFT_JOY) |
+                                 BUTTON_MASK(BTN_RIGHT_JOY);
+    if (getButtonStates().pressed & exitButtons) {
       // Exit display test
       displayTestActive = false;
       displayTestCompleted = false;
       buttonCheckEnabled = false;
       
       // Return to main menu
-      extern MenuState currentMenu;
-      extern int maxMenuItems;
-      extern int menuSelection;
-      extern int menuOffset;
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 8;
-      menuSelection = 0;
-      menuOffset = 0;
+      setCurrentMenu(MENU_MAIN);
       
       Serial.println("Display test cancelled by user");
       return;
@@ -113,14 +108,7 @@ void updateDisplayTest() {
         buttonCheckEnabled = false;
         
         // Return to main menu
-        extern MenuState currentMenu;
-        extern int maxMenuItems;
-        extern int menuSelection;
-        extern int menuOffset;
-        currentMenu = MENU_MAIN;
-        maxMenuItems = 8;
-        menuSelection = 0;
-        menuOffset = 0;
+        setCurrentMenu(MENU_MAIN);
         
         Serial.println("Display test sequence completed");
       }
@@ -133,8 +121,6 @@ void drawDisplayTestScreen() {
   
   // Draw the appropriate test pattern
   drawTestPattern(displayTestStep);
-  
-  display.display();
 }
 
 void drawTestPattern(int pattern) {
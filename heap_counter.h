@@ -0,0 +1,94 @@
+/*
+  heap_counter.h - Heap Allocation Counter
+  RC Transmitter for Teensy 4.0
+
+  Build with USE_HEAP_COUNTER 1 (config.h). malloc/calloc/realloc/free are
+  replaced by thin wrappers that count every allocation and then call the
+  newlib reentrant allocator (_malloc_r etc.) that the library versions
+  call themselves. Arduino String, new and the GFX code all end up there.
+  drawMenu() brackets each menu frame with beginHeapFrame()/endHeapFrame(),
+  and printHeapStats() reports the allocations per frame to Serial - it
+  should read 0 on every menu screen, the input and radio tests included.
+*/
+
+#ifndef HEAP_COUNTER_H
+#define HEAP_COUNTER_H
+
+#include "config.h"
+
+#if USE_HEAP_COUNTER
+#include <reent.h>
+
+volatile uint32_t heapAllocations = 0;
+
+extern "C" {
+  void* malloc(size_t size) {
+    heapAllocations++;
+    return _malloc_r(_REENT, size);
+  }
+
+  void free(void* ptr) {
+    _free_r(_REENT, ptr);
+  }
+
+  void* calloc(size_t count, size_t size) {
+    heapAllocations++;
+    return _calloc_r(_REENT, count, size);
+  }
+
+  void* realloc(void* ptr, size_t size) {
+    heapAllocations++;
+    return _realloc_r(_REENT, ptr, size);
+  }
+}
+#endif
+
+// Menu frame statistics
+uint32_t heapFrameStart = 0;
+uint32_t heapFrames = 0;
+uint32_t heapFrameAllocations = 0;
+uint32_t heapFrameMaxAllocations = 0;
+
+// Function declarations
+uint32_t getHeapAllocations();
+void beginHeapFrame();
+void endHeapFrame();
+void printHeapStats();
+
+uint32_t getHeapAllocations() {
+#if USE_HEAP_COUNTER
+  return heapAllocations;
+#else
+  return 0;
+#endif
+}
+
+void beginHeapFrame() {
+  heapFrameStart = getHeapAllocations();
+}
+
+void endHeapFrame() {
+  uint32_t allocations = getHeapAllocations() - heapFrameStart;
+  heapFrames++;
+  heapFrameAllocations += allocations;
+  if (allocations > heapFrameMaxAllocations) heapFrameMaxAllocations = allocations;
+}
+
+// Counters since the previous report, then restart them
+void printHeapStats() {
+  Serial.print("Heap allocations: ");
+  Serial.print(getHeapAllocations());
+  Serial.print(" total, ");
+  Serial.print(heapFrameAllocations);
+  Serial.print(" in ");
+  Serial.print(heapFrames);
+  Serial.print(" menu frames (max ");
+  Serial.print(heapFrameMaxAllocations);
+  Serial.println("/frame)");
+
+  heapFrames = 0;
+  heapFrameAllocations = 0;
+  heapFrameMaxAllocations = 0;
+}
+
+#endif
@@ -0,0 +1,232 @@
+/*
+  input_events.h - Input Event Engine (debounce, long-press, auto-repeat)
+  RC Transmitter for Teensy 4.0
+
+  Raw input masks (one bit per button or virtual input) are fed in with
+  microsecond timestamps - either from the pin-change capture buffer or
+  from a loop() snapshot. Each input has an integrator that counts the
+  time spent at the current raw level, so a contact has to be stable for
+  INPUT_DEBOUNCE_US before it changes state. Because the integration runs
+  on the captured timestamps, a tap that happened during a blocking call
+  is still debounced and reported with the time it really happened.
+  Debounced transitions and hold timing produce press/release/long-press/
+  repeat events that are queued in a small ring buffer for the menu.
+*/
+
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include "config.h"
+
+#define INPUT_MAX_INPUTS 16
+#define INPUT_EVENT_QUEUE_SIZE 16        // Must be a power of two
+
+// Debounce integrator
+#define INPUT_DEBOUNCE_US 5000           // 5 ms stable = state change
+
+// Hold timing
+#define INPUT_LONG_PRESS_MS 800          // Long-press for non-repeating inputs
+#define INPUT_REPEAT_DELAY_MS 350        // First repeat after this hold time
+#define INPUT_REPEAT_START_MS 180        // Initial repeat interval
+#define INPUT_REPEAT_MIN_MS 40           // Fastest repeat interval
+#define INPUT_REPEAT_ACCEL_MS 20         // Interval reduction per repeat
+#define INPUT_FAST_HOLD_MS 1500          // Repeats flagged "fast" (large steps) after this
+
+enum InputEventType {
+  INPUT_EVENT_PRESS = 0,
+  INPUT_EVENT_RELEASE,
+  INPUT_EVENT_LONG_PRESS,
+  INPUT_EVENT_REPEAT
+};
+
+struct InputEvent {
+  uint8_t input;          // Input index (ButtonId)
+  uint8_t type;           // InputEventType
+  uint8_t repeatCount;    // Repeats so far in this hold
+  bool fast;              // Held past INPUT_FAST_HOLD_MS
+  uint32_t timeMicros;    // micros() of the debounced transition / hold tick
+};
+
+// Per-input debounce and hold state
+struct InputChannelState {
+  uint16_t integratorUs;      // Time integrated towards "pressed", 0..INPUT_DEBOUNCE_US
+  uint8_t repeatCount;
+  bool longPressSent;
+  uint32_t pressTimeMicros;
+  uint32_t nextRepeatMicros;
+};
+
+InputChannelState inputChannels[INPUT_MAX_INPUTS];
+uint16_t debouncedInputMask = 0;
+uint16_t rawInputMask = 0;              // Raw level since inputClockMicros
+uint16_t inputRepeatMask = 0;           // Inputs that auto-repeat instead of long-pressing
+uint32_t inputClockMicros = 0;          // Time up to which inputs have been integrated
+uint16_t pendingPressEdges = 0;         // Debounced edges since the last takeInputEdges()
+uint16_t pendingReleaseEdges = 0;
+uint16_t pendingRepeatEdges = 0;        // Auto-repeat ticks since the last takeInputEdges()
+
+// Event queue (single producer/consumer, both in loop context)
+InputEvent inputEventQueue[INPUT_EVENT_QUEUE_SIZE];
+uint8_t inputEventHead = 0;
+uint8_t inputEventTail = 0;
+unsigned long inputEventsDropped = 0;
+
+// Function declarations
+void initInputEvents(uint16_t repeatMask);
+void feedInputMask(uint16_t rawMask, uint32_t atMicros, int numInputs);
+uint16_t updateInputEvents(uint16_t rawMask, int numInputs);
+void pushInputEvent(uint8_t input, uint8_t type, uint8_t repeatCount, bool fast, uint32_t atMicros);
+bool popInputEvent(InputEvent& event);
+void takeInputEdges(uint16_t& pressedEdges, uint16_t& releasedEdges, uint16_t& repeatEdges);
+uint32_t getInputPressMicros(int input);
+void flushInputEvents();
+int getInputEventCount();
+unsigned long getInputEventsDropped();
+
+void initInputEvents(uint16_t repeatMask) {
+  for (int i = 0; i < INPUT_MAX_INPUTS; i++) {
+    inputChannels[i].integratorUs = 0;
+    inputChannels[i].repeatCount = 0;
+    inputChannels[i].longPressSent = false;
+    inputChannels[i].pressTimeMicros = 0;
+    inputChannels[i].nextRepeatMicros = 0;
+  }
+  debouncedInputMask = 0;
+  rawInputMask = 0;
+  pendingPressEdges = 0;
+  pendingReleaseEdges = 0;
+  pendingRepeatEdges = 0;
+  inputRepeatMask = repeatMask;
+  inputClockMicros = micros();
+  flushInputEvents();
+  inputEventsDropped = 0;
+
+  Serial.println("Input event engine initialized");
+}
+
+// Integrate the previous raw levels up to atMicros, then switch to rawMask.
+// Timestamps must be fed in order; older ones are treated as "now".
+void feedInputMask(uint16_t rawMask, uint32_t atMicros, int numInputs) {
+  int32_t elapsed = (int32_t)(atMicros - inputClockMicros);
+  if (elapsed < 0) elapsed = 0;
+  if (elapsed > INPUT_DEBOUNCE_US) elapsed = INPUT_DEBOUNCE_US;
+
+  for (int i = 0; i < numInputs; i++) {
+    InputChannelState& ch = inputChannels[i];
+    uint16_t bit = (uint16_t)(1u << i);
+    bool wasDown = debouncedInputMask & bit;
+
+    // Integrate towards the raw level; the transition time is when the bound was reached
+    if (rawInputMask & bit) {
+      uint32_t needed = INPUT_DEBOUNCE_US - ch.integratorUs;
+      ch.integratorUs = min((int32_t)INPUT_DEBOUNCE_US, (int32_t)ch.integratorUs + elapsed);
+      if (!wasDown && ch.integratorUs == INPUT_DEBOUNCE_US) {
+        uint32_t t = inputClockMicros + needed;
+        debouncedInputMask |= bit;
+        pendingPressEdges |= bit;
+        ch.pressTimeMicros = t;
+        ch.nextRepeatMicros = t + INPUT_REPEAT_DELAY_MS * 1000UL;
+        ch.repeatCount = 0;
+        ch.longPressSent = false;
+        pushInputEvent(i, INPUT_EVENT_PRESS, 0, false, t);
+      }
+    } else {
+      uint32_t needed = ch.integratorUs;
+      ch.integratorUs = max((int32_t)0, (int32_t)ch.integratorUs - elapsed);
+      if (wasDown && ch.integratorUs == 0) {
+        debouncedInputMask &= ~bit;
+        pendingReleaseEdges |= bit;
+        pushInputEvent(i, INPUT_EVENT_RELEASE, ch.repeatCount, false, inputClockMicros + needed);
+      }
+    }
+  }
+
+  if ((int32_t)(atMicros - inputClockMicros) > 0) inputClockMicros = atMicros;
+  rawInputMask = rawMask;
+}
+
+// Feed the current raw mask and run hold timing; returns the debounced mask
+uint16_t updateInputEvents(uint16_t rawMask, int numInputs) {
+  uint32_t now = micros();
+  feedInputMask(rawMask, now, numInputs);
+
+  for (int i = 0; i < numInputs; i++) {
+    InputChannelState& ch = inputChannels[i];
+    uint16_t bit = (uint16_t)(1u << i);
+    if (!(debouncedInputMask & bit)) continue;
+
+    // Held - generate repeat or long-press events
+    if (inputRepeatMask & bit) {
+      if ((int32_t)(now - ch.nextRepeatMicros) >= 0) {
+        int interval = INPUT_REPEAT_START_MS - ch.repeatCount * INPUT_REPEAT_ACCEL_MS;
+        if (interval < INPUT_REPEAT_MIN_MS) interval = INPUT_REPEAT_MIN_MS;
+        if (ch.repeatCount < 255) ch.repeatCount++;
+        ch.nextRepeatMicros = now + interval * 1000UL;
+        pendingRepeatEdges |= bit;
+        pushInputEvent(i, INPUT_EVENT_REPEAT, ch.repeatCount,
+                       now - ch.pressTimeMicros >= INPUT_FAST_HOLD_MS * 1000UL, now);
+      }
+    } else if (!ch.longPressSent && now - ch.pressTimeMicros >= INPUT_LONG_PRESS_MS * 1000UL) {
+      ch.longPressSent = true;
+      pushInputEvent(i, INPUT_EVENT_LONG_PRESS, 0, false, now);
+    }
+  }
+
+  return debouncedInputMask;
+}
+
+void pushInputEvent(uint8_t input, uint8_t type, uint8_t repeatCount, bool fast, uint32_t atMicros) {
+  int count = getInputEventCount();
+
+  // Keep room for presses/releases - repeats are only queued while the queue is half empty
+  if (count >= INPUT_EVENT_QUEUE_SIZE - 1 ||
+      (type == INPUT_EVENT_REPEAT && count >= INPUT_EVENT_QUEUE_SIZE / 2)) {
+    inputEventsDropped++;
+    return;
+  }
+
+  InputEvent& event = inputEventQueue[inputEventHead];
+  event.input = input;
+  event.type = type;
+  event.repeatCount = repeatCount;
+  event.fast = fast;
+  event.timeMicros = atMicros;
+  inputEventHead = (inputEventHead + 1) & (INPUT_EVENT_QUEUE_SIZE - 1);
+}
+
+bool popInputEvent(InputEvent& event) {
+  if (inputEventHead == inputEventTail) return false;
+
+  event = inputEventQueue[inputEventTail];
+  inputEventTail = (inputEventTail + 1) & (INPUT_EVENT_QUEUE_SIZE - 1);
+  return true;
+}
+
+// Edges are accumulated so a complete tap inside one batch of captures still shows up
+void takeInputEdges(uint16_t& pressedEdges, uint16_t& releasedEdges, uint16_t& repeatEdges) {
+  pressedEdges = pendingPressEdges;
+  releasedEdges = pendingReleaseEdges;
+  repeatEdges = pendingRepeatEdges;
+  pendingPressEdges = 0;
+  pendingReleaseEdges = 0;
+  pendingRepeatEdges = 0;
+}
+
+// Time of the most recent debounced press of an input
+uint32_t getInputPressMicros(int input) {
+  return inputChannels[input].pressTimeMicros;
+}
+
+void flushInputEvents() {
+  inputEventTail = inputEventHead;
+}
+
+int getInputEventCount() {
+  return (inputEventHead - inputEventTail) & (INPUT_EVENT_QUEUE_SIZE - 1);
+}
+
+unsigned long getInputEventsDropped() {
+  return inputEventsDropped;
+}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+  latency_probe.h - Stick-to-Air Latency Instrumentation
+  RC Transmitter for Teensy 4.0
+
+  Build with USE_LATENCY_PROBE 1 (config.h). Each input snapshot is
+  timestamped when readJoysticks() starts acquiring it and again when
+  transmitData() hands its frame to the radio. The age of the sample at
+  hand-off goes into a histogram; frames carrying a sample older than
+  LATENCY_STALE_US are counted as stale. The radio write time and the
+  spacing between frames are tracked alongside, and everything is
+  printed to Serial every LATENCY_REPORT_PACKETS frames. With the flag at
+  0 the whole file compiles to nothing.
+*/
+
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include "config.h"
+
+#if USE_LATENCY_PROBE
+
+#define LATENCY_REPORT_PACKETS 500    // 10 s at 50 Hz
+#define LATENCY_STALE_US 5000         // Sample older than this at hand-off = stale frame
+#define LATENCY_HIST_BINS 10
+
+// Upper bin edges in microseconds (last bin is open-ended)
+const uint32_t latencyBinEdges[LATENCY_HIST_BINS - 1] = {
+  50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000
+};
+
+struct LatencyProbeStats {
+  uint32_t histogram[LATENCY_HIST_BINS];  // Sample age at hand-off
+  uint32_t frames;
+  uint32_t staleFrames;
+  uint32_t ageSum;
+  uint32_t ageMax;
+  uint32_t writeMax;                      // radio.write() duration incl. ACK/retries
+  uint32_t intervalMax;                   // Spacing between hand-offs
+};
+
+LatencyProbeStats latencyStats;
+uint32_t latencySnapshotMicros = 0;       // Acquisition time of the current snapshot
+uint32_t latencyHandoffMicros = 0;
+uint32_t latencyLastHandoffMicros = 0;
+
+// Function declarations
+void markInputSnapshot();
+void markRadioHandoff();
+void markRadioWriteDone();
+void resetLatencyProbe();
+void reportLatencyProbe();
+
+void markInputSnapshot() {
+  latencySnapshotMicros = micros();
+}
+
+void markRadioHandoff() {
+  uint32_t now = micros();
+  uint32_t age = now - latencySnapshotMicros;
+
+  int bin = 0;
+  while (bin < LATENCY_HIST_BINS - 1 && age >= latencyBinEdges[bin]) bin++;
+  latencyStats.histogram[bin]++;
+
+  latencyStats.frames++;
+  latencyStats.ageSum += age;
+  if (age > latencyStats.ageMax) latencyStats.ageMax = age;
+  if (age > LATENCY_STALE_US) latencyStats.staleFrames++;
+
+  if (latencyLastHandoffMicros != 0) {
+    uint32_t interval = now - latencyLastHandoffMicros;
+    if (interval > latencyStats.intervalMax) latencyStats.intervalMax = interval;
+  }
+  latencyLastHandoffMicros = now;
+  latencyHandoffMicros = now;
+}
+
+void markRadioWriteDone() {
+  uint32_t writeTime = micros() - latencyHandoffMicros;
+  if (writeTime > latencyStats.writeMax) latencyStats.writeMax = writeTime;
+
+  if (latencyStats.frames >= LATENCY_REPORT_PACKETS) {
+    reportLatencyProbe();
+    resetLatencyProbe();
+  }
+}
+
+void resetLatencyProbe() {
+  memset(&latencyStats, 0, sizeof(latencyStats));
+}
+
+void reportLatencyProbe() {
+  Serial.println("--- Latency Probe ---");
+  Serial.print("Frames: ");
+  Serial.print(latencyStats.frames);
+  Serial.print(" Stale (>");
+  Serial.print(LATENCY_STALE_US);
+  Serial.print("us): ");
+  Serial.println(latencyStats.staleFrames);
+
+  Serial.print("Sample age avg: ");
+  Serial.print(latencyStats.frames ? latencyStats.ageSum / latencyStats.frames : 0);
+  Serial.print("us max: ");
+  Serial.print(latencyStats.ageMax);
+  Serial.print("us  Radio write max: ");
+  Serial.print(latencyStats.writeMax);
+  Serial.print("us  Frame interval max: ");
+  Serial.print(latencyStats.intervalMax);
+  Serial.println("us");
+
+  for (int bin = 0; bin < LATENCY_HIST_BINS; bin++) {
+    Serial.print(bin == 0 ? 0 : latencyBinEdges[bin - 1]);
+    if (bin < LATENCY_HIST_BINS - 1) {
+      Serial.print("-");
+      Serial.print(latencyBinEdges[bin]);
+    } else {
+      Serial.print("+");
+    }
+    Serial.print("us: ");
+    Serial.println(latencyStats.histogram[bin]);
+  }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,313 @@
+/*
+  logic_switches.h - Switch Channels and Logic Switches
+  RC Transmitter for Teensy 4.0
+
+  The triggers, stick buttons and arm state are exposed as channel sources
+  next to the shaped stick and pot inputs (three-position triggers read
+  -1000 down / 0 middle / +1000 up). Logic switches L1-L6 are conditions
+  on those sources - thresholds, switch positions and AND/OR/XOR of other
+  sources. The definitions are compiled into a compact stack bytecode
+  list which is evaluated once per TX tick. Switches are evaluated in
+  order, so a switch referring to a later one sees its previous tick.
+  The results can drive the rate switch and go on air as switch bits,
+  also while disarmed (sticks read neutral then, the pots stay live).
+*/
+
+#ifndef LOGIC_SWITCHES_H
+#define LOGIC_SWITCHES_H
+
+#include <EEPROM.h>
+#include "config.h"
+#include "mixer.h"
+
+// EEPROM layout: ... deadzones at 640, logic switches at 704
+#define EEPROM_LOGIC_ADDRESS 704
+#define LOGIC_SIGNATURE 0x1A6C
+
+#define NUM_LOGIC_SWITCHES 6
+#define LOGIC_ON 1000
+#define LOGIC_OFF -1000
+#define LOGIC_VALUE_STEP 50
+
+// Channel sources (-1000 to +1000)
+enum LogicSource {
+  LS_SRC_STEERING = 0,      // Mixer inputs, same order as MixerInput
+  LS_SRC_THROTTLE,
+  LS_SRC_RIGHT_Y,
+  LS_SRC_LEFT_X,
+  LS_SRC_LEFT_POT,
+  LS_SRC_RIGHT_POT,
+  LS_SRC_LEFT_TRIGGER,      // Three-position: -1000 down, 0 middle, +1000 up
+  LS_SRC_RIGHT_TRIGGER,
+  LS_SRC_LEFT_JOY_BTN,      // 0 released, +1000 pressed
+  LS_SRC_RIGHT_JOY_BTN,
+  LS_SRC_ARMED,
+  LS_SRC_LOGIC,             // L1..L6: +1000 on, -1000 off
+  NUM_LOGIC_SOURCES = LS_SRC_LOGIC + NUM_LOGIC_SWITCHES
+};
+
+static_assert((int)LS_SRC_RIGHT_POT == (int)MIX_IN_RIGHT_POT, "Logic sources start with the mixer inputs");
+
+enum LogicFunction {
+  LS_FUNC_OFF = 0,
+  LS_FUNC_GREATER,          // A > value
+  LS_FUNC_LESS,             // A < value
+  LS_FUNC_ABS_GREATER,      // |A| > value
+  LS_FUNC_EQUAL,            // A == value (switch positions)
+  LS_FUNC_AND,              // A and B on (> 0)
+  LS_FUNC_OR,
+  LS_FUNC_XOR,
+  NUM_LOGIC_FUNCTIONS
+};
+
+// Bytecode - compare ops carry a source byte and a little-endian int16
+enum LogicOpcode {
+  LOP_END = 0,
+  LOP_GREATER,              // src, imm16 -> push
+  LOP_LESS,
+  LOP_ABS_GREATER,
+  LOP_EQUAL,
+  LOP_ON,                   // src -> push src > 0
+  LOP_AND,                  // pop 2, push 1
+  LOP_OR,
+  LOP_XOR,
+  LOP_STORE                 // index -> pop into L<index>
+};
+
+#define LOGIC_PROGRAM_SIZE (NUM_LOGIC_SWITCHES * 7 + 1)  // Worst case: ON, ON, AND, STORE per switch
+
+// One user-defined switch
+struct LogicSwitchDef {
+  uint8_t function;         // LogicFunction
+  uint8_t sourceA;          // LogicSource
+  uint8_t sourceB;          // LogicSource (AND/OR/XOR)
+  int16_t value;            // Threshold or position (compare functions)
+};
+
+// Logic switch data stored in EEPROM
+struct LogicSwitchData {
+  LogicSwitchDef switches[NUM_LOGIC_SWITCHES];
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+LogicSwitchData logicData;
+
+// Runtime state
+int16_t logicSources[NUM_LOGIC_SOURCES];    // Filled by readJoysticks() each tick
+uint8_t logicProgram[LOGIC_PROGRAM_SIZE];
+uint8_t logicSwitchBits = 0;                // Bit per logic switch
+uint8_t logicInputsUsed = 0;                // Bit per mixer input referenced by a switch
+
+// Function declarations
+void initLogicSwitches();
+void saveLogicSwitches();
+void loadLogicSwitches();
+void resetLogicSwitches();
+int compileLogicSwitches();
+int emitLogicCompare(int pc, uint8_t op, uint8_t source, int16_t value);
+void runLogicSwitches();
+bool isLogicSwitchOn(int index);
+bool isLogicInputUsed(int input);
+bool isLogicCompareFunction(int function);
+const char* getLogicFunctionName(int function);
+const char* getLogicSourceName(int source);
+const char* getLogicSwitchSummary(int index);
+
+void initLogicSwitches() {
+  loadLogicSwitches();
+  int length = compileLogicSwitches();
+  Serial.print("Logic switches compiled: ");
+  Serial.print(length);
+  Serial.println(" bytes");
+}
+
+void saveLogicSwitches() {
+  logicData.signature = LOGIC_SIGNATURE;
+  EEPROM.put(EEPROM_LOGIC_ADDRESS, logicData);
+  Serial.println("Logic switches saved to EEPROM");
+}
+
+void loadLogicSwitches() {
+  EEPROM.get(EEPROM_LOGIC_ADDRESS, logicData);
+
+  if (logicData.signature != LOGIC_SIGNATURE) {
+    Serial.println("No valid logic switches found, using defaults");
+    resetLogicSwitches();
+  } else {
+    Serial.println("Logic switches loaded from EEPROM");
+  }
+}
+
+void resetLogicSwitches() {
+  memset(&logicData, 0, sizeof(logicData));
+  for (int i = 0; i < NUM_LOGIC_SWITCHES; i++) {
+    logicData.switches[i].function = LS_FUNC_OFF;
+    logicData.switches[i].sourceA = LS_SRC_RIGHT_TRIGGER;
+    logicData.switches[i].sourceB = LS_SRC_LOGIC;
+  }
+  logicData.signature = LOGIC_SIGNATURE;
+}
+
+// Definitions -> bytecode. Switches that are off (or invalid) emit nothing and stay off.
+// Silent - the editor recompiles on every step; returns the program length in bytes.
+int compileLogicSwitches() {
+  int pc = 0;
+  logicInputsUsed = 0;
+  logicSwitchBits = 0;
+
+  for (int i = 0; i < NUM_LOGIC_SWITCHES; i++) {
+    const LogicSwitchDef& def = logicData.switches[i];
+    logicSources[LS_SRC_LOGIC + i] = LOGIC_OFF;
+
+    if (def.sourceA >= NUM_LOGIC_SOURCES || def.sourceB >= NUM_LOGIC_SOURCES) continue;
+
+    switch (def.function) {
+      case LS_FUNC_GREATER:     pc = emitLogicCompare(pc, LOP_GREATER, def.sourceA, def.value); break;
+      case LS_FUNC_LESS:        pc = emitLogicCompare(pc, LOP_LESS, def.sourceA, def.value); break;
+      case LS_FUNC_ABS_GREATER: pc = emitLogicCompare(pc, LOP_ABS_GREATER, def.sourceA, def.value); break;
+      case LS_FUNC_EQUAL:       pc = emitLogicCompare(pc, LOP_EQUAL, def.sourceA, def.value); break;
+      case LS_FUNC_AND:
+      case LS_FUNC_OR:
+      case LS_FUNC_XOR:
+        logicProgram[pc++] = LOP_ON;
+        logicProgram[pc++] = def.sourceA;
+        logicProgram[pc++] = LOP_ON;
+        logicProgram[pc++] = def.sourceB;
+        logicProgram[pc++] = def.function == LS_FUNC_AND ? LOP_AND : def.function == LS_FUNC_OR ? LOP_OR : LOP_XOR;
+        if (def.sourceB < NUM_MIX_INPUTS) logicInputsUsed |= (1 << def.sourceB);
+        break;
+      default:
+        continue;
+    }
+
+    logicProgram[pc++] = LOP_STORE;
+    logicProgram[pc++] = i;
+    if (def.sourceA < NUM_MIX_INPUTS) logicInputsUsed |= (1 << def.sourceA);
+  }
+  logicProgram[pc++] = LOP_END;
+  return pc;
+}
+
+int emitLogicCompare(int pc, uint8_t op, uint8_t source, int16_t value) {
+  logicProgram[pc++] = op;
+  logicProgram[pc++] = source;
+  logicProgram[pc++] = (uint16_t)value & 0xFF;
+  logicProgram[pc++] = (uint16_t)value >> 8;
+  return pc;
+}
+
+// Evaluate the bytecode over logicSources[] - bit 0 of the stack word is the top
+void runLogicSwitches() {
+  const uint8_t* pc = logicProgram;
+  uint32_t stack = 0;
+
+  for (;;) {
+    uint8_t op = *pc++;
+    switch (op) {
+      case LOP_GREATER:
+      case LOP_LESS:
+      case LOP_ABS_GREATER:
+      case LOP_EQUAL: {
+        int16_t a = logicSources[pc[0]];
+        int16_t value = (int16_t)(pc[1] | (pc[2] << 8));
+        pc += 3;
+        bool result;
+        if (op == LOP_GREATER) result = a > value;
+        else if (op == LOP_LESS) result = a < value;
+        else if (op == LOP_ABS_GREATER) result = abs(a) > value;
+        else result = a == value;
+        stack = (stack << 1) | result;
+        break;
+      }
+      case LOP_ON:
+        stack = (stack << 1) | (logicSources[*pc++] > 0);
+        break;
+      case LOP_AND:
+        stack = ((stack >> 2) << 1) | ((stack & (stack >> 1)) & 1);
+        break;
+      case LOP_OR:
+        stack = ((stack >> 2) << 1) | ((stack | (stack >> 1)) & 1);
+        break;
+      case LOP_XOR:
+        stack = ((stack >> 2) << 1) | ((stack ^ (stack >> 1)) & 1);
+        break;
+      case LOP_STORE: {
+        uint8_t index = *pc++;
+        bool on = stack & 1;
+        stack >>= 1;
+        logicSources[LS_SRC_LOGIC + index] = on ? LOGIC_ON : LOGIC_OFF;
+        if (on) logicSwitchBits |= (1 << index);
+        else logicSwitchBits &= ~(1 << index);
+        break;
+      }
+      default:  // LOP_END
+        return;
+    }
+  }
+}
+
+bool isLogicSwitchOn(int index) {
+  return logicSwitchBits & (1 << index);
+}
+
+bool isLogicInputUsed(int input) {
+  return logicInputsUsed & (1 << input);
+}
+
+bool isLogicCompareFunction(int function) {
+  return function >= LS_FUNC_GREATER && function <= LS_FUNC_EQUAL;
+}
+
+const char* getLogicFunctionName(int function) {
+  switch (function) {
+    case LS_FUNC_GREATER: return "A>X";
+    case LS_FUNC_LESS: return "A<X";
+    case LS_FUNC_ABS_GREATER: return "|A|>X";
+    case LS_FUNC_EQUAL: return "A=X";
+    case LS_FUNC_AND: return "AND";
+    case LS_FUNC_OR: return "OR";
+    case LS_FUNC_XOR: return "XOR";
+    default: return "OFF";
+  }
+}
+
+const char* getLogicSourceName(int source) {
+  static const char* const names[NUM_LOGIC_SOURCES] = {
+    "Steer", "Thr", "RY", "LX", "LPot", "RPot",
+    "LTrig", "RTrig", "LJoy", "RJoy", "Armed",
+    "L1", "L2", "L3", "L4", "L5", "L6"
+  };
+  static_assert(NUM_LOGIC_SWITCHES == 6, "Update the logic source names");
+  return source < NUM_LOGIC_SOURCES ? names[source] : "???";
+}
+
+// Short form for the menu, e.g. "Thr>500" or "L1 AND RJoy"
+const char* getLogicSwitchSummary(int index) {
+  static char summary[20];
+  const LogicSwitchDef& def = logicData.switches[index];
+
+  switch (def.function) {
+    case LS_FUNC_GREATER:
+    case LS_FUNC_LESS:
+    case LS_FUNC_EQUAL:
+      snprintf(summary, sizeof(summary), "%s%c%d", getLogicSourceName(def.sourceA),
+               def.function == LS_FUNC_GREATER ? '>' : def.function == LS_FUNC_LESS ? '<' : '=', def.value);
+      break;
+    case LS_FUNC_ABS_GREATER:
+      snprintf(summary, sizeof(summary), "|%s|>%d", getLogicSourceName(def.sourceA), def.value);
+      break;
+    case LS_FUNC_AND:
+    case LS_FUNC_OR:
+    case LS_FUNC_XOR:
+      snprintf(summary, sizeof(summary), "%s %s %s", getLogicSourceName(def.sourceA),
+               getLogicFunctionName(def.function), getLogicSourceName(def.sourceB));
+      break;
+    default:
+      return "---";
+  }
+  return summary;
+}
+
+#endif
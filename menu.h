@@ -15,21 +15,17 @@
 #include "menu_calibration.h"
 #include "display_test.h"
 #include "test_buttons.h"
+#include "heap_counter.h"
+#include "menu_tree.h"
 
 // Menu navigation variables - declare extern where used in other files
 MenuState currentMenu = MENU_HIDDEN;
 MenuState previousMenu = MENU_HIDDEN;
 int menuSelection = 0;
 int menuOffset = 0;
-int maxMenuItems = 0;
 int maxVisibleItems = 4;
 bool menuActive = false;
 unsigned long menuTimer = 0;
-bool lastOkButtonState = false;
-
-// Navigation timing
-unsigned long lastNavigation = 0;
-#define NAV_DEBOUNCE 200
 
 // Cancel confirmation variables
 bool cancelConfirmActive = false;
@@ -38,14 +34,15 @@ int cancelSelection = 0; // 0 = Cancel, 1 = OK
 // Function declarations
 void initMenu();
 void updateMenu();
-void handleMenuNavigation();
+void handleMenuEvent(const InputEvent& event);
+void handleMenuNavigation(const InputEvent& event);
 void enterMenu();
 void exitMenu();
 void selectMenuItem();
 void goBack();
 void showCancelConfirm();
-void handleCancelConfirmation();
-int getNavigationDirection();
+void handleCancelConfirmation(const InputEvent& event);
+int getNavigationDirection(const InputEvent& event);
 bool isMenuActive();
 void drawMenu();
 
@@ -67,170 +64,185 @@ void initMenu() {
 void updateMenu() {
   // Handle factory reset updates first
   if (isFactoryResetActive()) {
+    flushInputEvents();
     updateFactoryReset();
     return; // Don't process other menu updates during factory reset
   }
 
-  // Handle display test updates
+  // Handle display test updates (reads button levels directly)
   if (isDisplayTestActive()) {
+    flushInputEvents();
     updateDisplayTest();
     return;
   }
 
-  // Handle input test updates
+  // Handle input test updates (reads button levels directly)
   if (isButtonTestActive()) {
+    flushInputEvents();
     updateButtonTest();
     return;
   }
-    
+  
+  // Consume queued input events - each one goes to whatever mode is active when it is handled
+  InputEvent event;
+  while (popInputEvent(event)) {
+    handleMenuEvent(event);
+  }
+  
+  // Sweep calibration samples the sticks on every pass
+  if (isCalibrationActive()) {
+    updateCalibrationSweep();
+  }
+  
+  // Auto-exit menu after 30 seconds of inactivity
+  if (currentMenu != MENU_HIDDEN && millis() - menuTimer > 30000) {
+    exitMenu();
+  }
+}
+
+void handleMenuEvent(const InputEvent& event) {
+  bool pressed = (event.type == INPUT_EVENT_PRESS);
+  
+  if (currentMenu == MENU_HIDDEN) {
+    if (pressed && event.input == BTN_OK) {
+      // Simple press from homepage - enter menu immediately
+      enterMenu();
+      Serial.println("OK pressed from homepage - entering menu");
+    }
+    return;
+  }
+  
+  menuTimer = millis();
+  
   // Handle cancel confirmation first
   if (cancelConfirmActive) {
-    handleCancelConfirmation();
+    handleCancelConfirmation(event);
     return;
   }
   
-  // Check for right joystick button press (cancel function)
-  if (buttons.rightJoyBtn && millis() - lastNavigation > NAV_DEBOUNCE) {
-    if (currentMenu != MENU_MAIN && currentMenu != MENU_HIDDEN) {
-      showCancelConfirm();
-      return;
-    }
+  // Right joystick button = cancel (the keyboard uses it as SAVE)
+  if (pressed && event.input == BTN_RIGHT_JOY && currentMenu != MENU_MAIN && !keyboardActive) {
+    showCancelConfirm();
+    return;
   }
   
-  // Simple OK button press handling
-  bool currentOkState = buttons.btnOK;
+  // Route to the active subsystem
+  if (isCalibrationActive()) {
+    updateMenuCalibration(event);
+    return;
+  }
+  if (isSettingActive()) {
+    updateMenuSettings(event);
+    return;
+  }
   
-  // Rising edge detection for OK button - but only handle it if we're not in special modes
-  if (currentOkState && !lastOkButtonState) {
-    // Add debounce protection
-    if (millis() - lastNavigation > NAV_DEBOUNCE) {
-      if (currentMenu == MENU_HIDDEN) {
-        // Simple press from homepage - enter menu immediately
-        enterMenu();
-        Serial.println("OK pressed from homepage - entering menu");
-        lastNavigation = millis();
-      } else if (currentMenu == MENU_RADIO_TEST) {
-        // OK button pressed during radio test - go back to main menu
-        goBack();
-        lastNavigation = millis();
-      } else if (!isSettingActive() && !isCalibrationActive()) {
-        // Only handle menu selection if we're not in setting or calibration mode
-        if (!isInSettingLockout()) {
-          selectMenuItem();
-          Serial.println("OK pressed in menu - selecting item");
-        } else {
-          Serial.println("Menu selection blocked - setting lockout active");
-        }
-        lastNavigation = millis();
-      }
-    }
+  // Ignore input while the "saved" screen is shown
+  if (isInSettingLockout()) {
+    return;
   }
   
-  lastOkButtonState = currentOkState;
+  // Hold left joystick button to leave the menu from anywhere
+  if (event.type == INPUT_EVENT_LONG_PRESS && event.input == BTN_LEFT_JOY) {
+    Serial.println("Left joystick long-press - leaving menu");
+    exitMenu();
+    return;
+  }
   
-  // Handle different subsystem updates
-  if (currentMenu != MENU_HIDDEN) {
-    // Update appropriate subsystem
-    if (isCalibrationActive()) {
-      updateMenuCalibration();
-    } else if (isSettingActive()) {
-      updateMenuSettings();
+  if (pressed && event.input == BTN_OK) {
+    if (currentMenu == MENU_RADIO_TEST) {
+      // OK button pressed during radio test - go back to main menu
+      goBack();
     } else {
-      // Only handle navigation if not in setting lockout
-      if (!isInSettingLockout()) {
-        handleMenuNavigation();
-      }
-    }
-    
-    // Auto-exit menu after 30 seconds of inactivity
-    if (millis() - menuTimer > 30000) {
-      exitMenu();
+      selectMenuItem();
+      Serial.println("OK pressed in menu - selecting item");
     }
+    return;
   }
+  
+  handleMenuNavigation(event);
 }
 
-void handleMenuNavigation() {
-  if (millis() - lastNavigation < NAV_DEBOUNCE) return;
+void handleMenuNavigation(const InputEvent& event) {
+  int navDirection = getNavigationDirection(event);
+  if (navDirection == 0) return;
   
-  int navDirection = getNavigationDirection();
-  if (navDirection != 0) {
-    menuTimer = millis();
-    
-    if (navDirection == 1) { // Down
-      extern void playNavigationDownSound();
-      playNavigationDownSound();
-      menuSelection++;
-      if (menuSelection >= maxMenuItems) {
-        menuSelection = 0;
-        menuOffset = 0;
-      } else if (menuSelection >= menuOffset + maxVisibleItems) {
-        menuOffset++;
-      }
-    } else if (navDirection == -1) { // Up
-      extern void playNavigationUpSound();
-      playNavigationUpSound();
-      menuSelection--;
-      if (menuSelection < 0) {
-        menuSelection = maxMenuItems - 1;
-        menuOffset = max(0, maxMenuItems - maxVisibleItems);
-      } else if (menuSelection < menuOffset) {
-        menuOffset--;
-      }
-    } else if (navDirection == 2) { // Right/Select
-      if (!isInSettingLockout()) {
-        extern void playSelectSound();
-        playSelectSound();
-        selectMenuItem();
-      }
-    } else if (navDirection == -2) { // Left/Back
-      extern void playBackSound();
-      playBackSound();
-      goBack();
+  int itemCount = getMenuNode(currentMenu).itemCount;
+  if (itemCount == 0 && (navDirection == 1 || navDirection == -1)) return;  // Screen without items
+  
+  if (navDirection == 1) { // Down
+    extern void playNavigationDownSound();
+    playNavigationDownSound();
+    menuSelection++;
+    if (menuSelection >= itemCount) {
+      menuSelection = 0;
+      menuOffset = 0;
+    } else if (menuSelection >= menuOffset + maxVisibleItems) {
+      menuOffset++;
+    }
+  } else if (navDirection == -1) { // Up
+    extern void playNavigationUpSound();
+    playNavigationUpSound();
+    menuSelection--;
+    if (menuSelection < 0) {
+      menuSelection = itemCount - 1;
+      menuOffset = max(0, itemCount - maxVisibleItems);
+    } else if (menuSelection < menuOffset) {
+      menuOffset--;
     }
-    
-    lastNavigation = millis();
+  } else if (event.type == INPUT_EVENT_REPEAT) {
+    // Holding select/back must not walk through several menu levels
+    return;
+  } else if (navDirection == 2) { // Right/Select
+    extern void playSelectSound();
+    playSelectSound();
+    selectMenuItem();
+  } else if (navDirection == -2) { // Left/Back
+    extern void playBackSound();
+    playBackSound();
+    goBack();
   }
 }
 
-void handleCancelConfirmation() {
-  if (millis() - lastNavigation < NAV_DEBOUNCE) return;
-  
-  int navDirection = getNavigationDirection();
-  if (navDirection != 0) {
-    if (navDirection == 2 || navDirection == -2) { // Left or Right
+void handleCancelConfirmation(const InputEvent& event) {
+  int navDirection = getNavigationDirection(event);
+  if (navDirection == 2 || navDirection == -2) { // Left or Right
+    if (event.type == INPUT_EVENT_PRESS) {
       cancelSelection = 1 - cancelSelection; // Toggle between 0 and 1
     }
-    lastNavigation = millis();
+    return;
   }
   
   // Check for OK to confirm selection
-  if (buttons.btnOK && millis() - lastNavigation > NAV_DEBOUNCE) {
+  if (event.type == INPUT_EVENT_PRESS && event.input == BTN_OK) {
     if (cancelSelection == 1) { // OK selected - cancel operation
       exitMenu();
     }
     cancelConfirmActive = false;
-    lastNavigation = millis();
   }
 }
 
-int getNavigationDirection() {
+// Map a press/repeat event to a navigation direction (1 down, -1 up, 2 right, -2 left)
+int getNavigationDirection(const InputEvent& event) {
+  if (event.type != INPUT_EVENT_PRESS && event.type != INPUT_EVENT_REPEAT) return 0;
+  
   // Always allow arrow button navigation
-  if (buttons.btnDown) return 1;
-  if (buttons.btnUp) return -1;
-  if (buttons.btnRight) return 2;
-  if (buttons.btnLeft) return -2;
+  switch (event.input) {
+    case BTN_DOWN: return 1;
+    case BTN_UP: return -1;
+    case BTN_RIGHT: return 2;
+    case BTN_LEFT: return -2;
+    default: break;
+  }
   
   // Allow joystick navigation only when not in special modes
   if (!isSettingActive() && !isCalibrationActive()) {
-    int rightJoyY = analogRead(RIGHT_JOY_Y);
-    int leftJoyY = analogRead(LEFT_JOY_Y);
-    int rightJoyX = analogRead(RIGHT_JOY_X);
-    int leftJoyX = analogRead(LEFT_JOY_X);
-    
-    if (rightJoyY < 200 || leftJoyY > 800) return -1; // Up
-    if (rightJoyY > 800 || leftJoyY < 200) return 1;  // Down
-    if (rightJoyX < 200 || leftJoyX > 800) return -2; // Left
-    if (rightJoyX > 800 || leftJoyX < 200) return 2;  // Right
+    switch (event.input) {
+      case BTN_STICK_DOWN: return 1;
+      case BTN_STICK_UP: return -1;
+      case BTN_STICK_RIGHT: return 2;
+      case BTN_STICK_LEFT: return -2;
+      default: break;
+    }
   }
   
   return 0;
@@ -240,10 +252,7 @@ void enterMenu() {
   Serial.println("Entering enhanced menu...");
   extern void playMenuEnterSound();
   playMenuEnterSound();
-  currentMenu = MENU_MAIN;
-  maxMenuItems = 10;  // Updated from 9 to 10 to include Audio Settings
-  menuSelection = 0;
-  menuOffset = 0;
+  setCurrentMenu(MENU_MAIN);
   menuTimer = millis();
   menuActive = true;
   applyLEDSettings();
@@ -268,82 +277,26 @@ void showCancelConfirm() {
   cancelSelection = 0; // Default to "Cancel"
 }
 
+// Back goes to the node's parent (menu_tree.h) - running its leave hook first
 void goBack() {
-  switch (currentMenu) {
-    case MENU_MAIN:
-      exitMenu();
-      break;
-    case MENU_CALIBRATION:
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_SETTINGS:
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_RANGE_SETTINGS:
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_AUDIO_SETTINGS:  // NEW: Audio settings back navigation
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_DISPLAY_TEST:
-      // Reset display test state and go back to main menu
-      resetDisplayTest();
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_BUTTON_TEST:
-      // Reset input test state and go back to main menu
-      resetButtonTest();
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_INFO:
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_RADIO_TEST:
-      // Reset radio test state and go back to main menu
-      extern void resetRadioTest();
-      resetRadioTest();
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_FACTORY_RESET_CONFIRM:
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 10;  // Updated to 10
-      break;
-    case MENU_FACTORY_RESET_FINAL:
-      currentMenu = MENU_FACTORY_RESET_CONFIRM;
-      maxMenuItems = 2;
-      break;
-    case MENU_JOYSTICK_CAL:
-    case MENU_POTENTIOMETER_CAL:
-      currentMenu = MENU_CALIBRATION;
-      maxMenuItems = 3; // Reduced from 4 after removing MPU6500
-      break;
-    case MENU_LED_SETTINGS:
-    case MENU_FAILSAFE_SETTINGS:
-      currentMenu = MENU_SETTINGS;
-      maxMenuItems = 8;
-      break;
-    default:
-      // Let subsystems handle their own back navigation
-      if (isSettingActive()) {
-        goBackSettings();
-      } else if (isCalibrationActive()) {
-        goBackCalibration();
-      } else {
-        currentMenu = MENU_MAIN;
-        maxMenuItems = 10;  // Updated to 10
-      }
-      break;
+  if (currentMenu == MENU_MAIN) {
+    exitMenu();
+    return;
   }
-  menuSelection = 0;
-  menuOffset = 0;
+  
+  // Let subsystems handle their own back navigation
+  if (isSettingActive()) {
+    goBackSettings();
+    return;
+  }
+  if (isCalibrationActive()) {
+    goBackCalibration();
+    return;
+  }
+  
+  const MenuNode& node = getMenuNode(currentMenu);
+  if (node.leave) node.leave();
+  setCurrentMenu(node.parent);
 }
 
 void selectMenuItem() {
@@ -353,158 +306,10 @@ void selectMenuItem() {
     return;
   }
   
-  switch (currentMenu) {
-    case MENU_MAIN:
-      switch (menuSelection) {
-        case 0: // Calibration
-          currentMenu = MENU_CALIBRATION;
-          maxMenuItems = 3; // Reduced from 4 after removing MPU6500
-          break;
-        case 1: // Settings
-          currentMenu = MENU_SETTINGS;
-          maxMenuItems = 8;
-          break;
-        case 2: // Range Settings
-          currentMenu = MENU_RANGE_SETTINGS;
-          maxMenuItems = 7;
-          break;
-        case 3: // NEW: Audio Settings
-          currentMenu = MENU_AUDIO_SETTINGS;
-          maxMenuItems = 9;
-          break;
-        case 4: // System Info (moved from 3)
-          currentMenu = MENU_INFO;
-          maxMenuItems = 5;  // Updated to 5 to include audio system info
-          break;
-        case 5: // Radio Test (moved from 4)
-          // Start radio test and show results
-          extern void startRadioTest();
-          startRadioTest();
-          currentMenu = MENU_RADIO_TEST;
-          break;
-        case 6: // Display Test (moved from 5)
-          startDisplayTest();
-          currentMenu = MENU_DISPLAY_TEST;
-          break;
-        case 7: // Input Test (moved from 6)
-          startButtonTest();
-          currentMenu = MENU_BUTTON_TEST;
-          break;
-        case 8: // Factory Reset (moved from 7)
-          currentMenu = MENU_FACTORY_RESET_CONFIRM;
-          maxMenuItems = 2;
-          break;
-        case 9: // Exit (moved from 8)
-          exitMenu();
-          return;
-      }
-      break;
-      
-    case MENU_CALIBRATION:
-      switch (menuSelection) {
-        case 0: 
-          currentMenu = MENU_JOYSTICK_CAL; 
-          maxMenuItems = 5; 
-          break;
-        case 1: 
-          currentMenu = MENU_POTENTIOMETER_CAL; 
-          maxMenuItems = 3; 
-          break;
-        case 2: // Back (moved from index 3)
-          goBack(); 
-          return;
-      }
-      break;
-      
-    case MENU_JOYSTICK_CAL:
-      switch (menuSelection) {
-        case 0: startCalibration("JOYSTICK", "RIGHT_X"); return;
-        case 1: startCalibration("JOYSTICK", "RIGHT_Y"); return;
-        case 2: startCalibration("JOYSTICK", "LEFT_X"); return;
-        case 3: startCalibration("JOYSTICK", "LEFT_Y"); return;
-        case 4: goBack(); return;
-      }
-      break;
-      
-    case MENU_POTENTIOMETER_CAL:
-      switch (menuSelection) {
-        case 0: startCalibration("POTENTIOMETER", "LEFT"); return;
-        case 1: startCalibration("POTENTIOMETER", "RIGHT"); return;
-        case 2: goBack(); return;
-      }
-      break;
-      
-    case MENU_SETTINGS:
-      switch (menuSelection) {
-        case 0: startSetting("DEADZONE"); return;
-        case 1: startSetting("BRIGHTNESS"); return;
-        case 2: 
-          currentMenu = MENU_LED_SETTINGS; 
-          maxMenuItems = 7; 
-          break;
-        case 3: startSetting("RADIO_ADDRESS"); return;
-        case 4: startSetting("CHANNEL"); return;
-        case 5: 
-          currentMenu = MENU_FAILSAFE_SETTINGS; 
-          maxMenuItems = 4;
-          break;
-        case 6: resetAllSettings(); break;
-        case 7: goBack(); return;
-      }
-      break;
-      
-    // Range Settings Menu
-    case MENU_RANGE_SETTINGS:
-      handleRangeSettingsSelection(menuSelection);
-      if (menuSelection == 6) goBack(); // Back option
-      return;
-      
-    // NEW: Audio Settings Menu
-    case MENU_AUDIO_SETTINGS:
-      handleAudioSettingsSelection(menuSelection);
-      if (menuSelection == 8) goBack(); // Back option
-      return;
-      
-    case MENU_LED_SETTINGS:
-      handleLEDSettingsSelection(menuSelection);
-      if (menuSelection == 6) goBack(); // Back option
-      return;
-      
-    case MENU_FAILSAFE_SETTINGS:
-      handleFailsafeSettingsSelection(menuSelection);
-      if (menuSelection == 3) goBack(); // Back option
-      return;
-      
-    case MENU_INFO:
-      if (menuSelection == maxMenuItems - 1) {
-        goBack();
-        return;
-      }
-      break;
-      
-    // Factory Reset Menu Handling
-    case MENU_FACTORY_RESET_CONFIRM:
-      if (menuSelection == 0) { // No selected
-        goBack(); // Return to main menu
-      } else { // Yes selected
-        currentMenu = MENU_FACTORY_RESET_FINAL;
-        maxMenuItems = 2; // No/Yes options
-        menuSelection = 0; // Default to No on final confirmation
-      }
-      return;
-      
-    case MENU_FACTORY_RESET_FINAL:
-      if (menuSelection == 0) { // No selected
-        goBack(); // Return to previous confirmation
-      } else { // YES selected - start factory reset
-        currentMenu = MENU_FACTORY_RESET_PROGRESS;
-        startFactoryReset();
-      }
-      return;
-  }
+  const MenuNode& node = getMenuNode(currentMenu);
+  if (node.items == NULL || menuSelection >= node.itemCount) return;
   
-  menuSelection = 0;
-  menuOffset = 0;
+  runMenuItem(node.items[menuSelection]);
   menuTimer = millis();
 }
 
@@ -516,6 +321,7 @@ bool isMenuActive() {
 void drawMenu() {
   if (currentMenu == MENU_HIDDEN) return;
   
+  beginHeapFrame();
   display.clearDisplay();
   
   // Check for factory reset first
@@ -541,7 +347,8 @@ void drawMenu() {
     drawMainMenus();
   }
   
-  display.display();
+  endHeapFrame();
+  requestDisplayFlush();
 }
 
 #endif
\ No newline at end of file
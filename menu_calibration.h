@@ -10,218 +10,190 @@
 #include "config.h"
 #include "display.h"
 #include "menu_data.h"
+#include "stats.h"
+
+// What is being calibrated
+enum CalibrationType {
+  CAL_TYPE_NONE = 0,
+  CAL_TYPE_AXIS,      // One axis, Neutral/Max/Min snapshots
+  CAL_TYPE_SWEEP      // All stick axes, continuous sampling
+};
 
 // Calibration variables
 bool calibrationActive = false;
-String currentCalType = "";
-String currentCalAxis = "";
+CalibrationType currentCalType = CAL_TYPE_NONE;
+int currentCalAxis = AXIS_RIGHT_X;
 int calStep = 0;
 int maxCalSteps = 0;
 bool waitingForOK = false;
 CalibrationState calState = CAL_IDLE;
 
+// Sweep calibration - all stick axes at once
+#define SWEEP_AXES NUM_STICK_AXES
+#define SWEEP_SAMPLE_US 1000          // Target sample period (1 kHz)
+#define SWEEP_SETTLE_MS 300           // Ignored after entering the neutral phase
+#define SWEEP_NEUTRAL_MS 2000         // Neutral sampling time
+#define SWEEP_WARMUP_SAMPLES 32       // Accepted unconditionally before outlier rejection starts
+#define SWEEP_OUTLIER_SIGMA 4         // Neutral samples further than this many sigma are rejected
+#define SWEEP_MIN_NOISE 1.0f          // Sigma floor (counts) for the rejection band
+#define SWEEP_MAX_NOISE 20.0f         // More than this means the stick was touched - restart
+#define SWEEP_FULL_SPAN 700           // Raw span that counts as a full sweep (ADC counts)
+#define SWEEP_DZ_MARGIN 10            // Added to the measured noise for the recommendation
+
+struct SweepAxisStats {
+  RunningStats neutral;   // Accepted neutral samples (Welford mean/variance)
+  uint32_t rejected;      // Neutral outliers
+  int peakDeviation;      // Largest accepted deviation from the mean (counts)
+  int history[2];         // Last two raw samples for the median-of-3 spike filter
+  int minValue;
+  int maxValue;
+  int recommendedDeadzone;
+};
+
+SweepAxisStats sweepStats[SWEEP_AXES];
+int sweepCurrent[SWEEP_AXES];
+unsigned long sweepPhaseStart = 0;
+uint32_t sweepLastSampleMicros = 0;
+uint32_t sweepSampleCount = 0;
+
 // External variables from menu.h
 extern MenuState currentMenu;
 extern int menuSelection;
 extern int menuOffset;
-extern int maxMenuItems;
-extern unsigned long lastNavigation;
 
 // Function declarations
 void initMenuCalibration();
-void updateMenuCalibration();
-void startCalibration(String calType, String axis);
+void updateMenuCalibration(const InputEvent& event);
+void startAxisCalibration(int axis);
+void startSweepCalibration();
+void returnToCalibrationMenu();
 void completeCalibration();
 void exitMenuCalibration();
 void goBackCalibration();
 void drawMenuCalibration();
 void drawCalibrationScreen();
-String getCalibrationStepText();
+const char* getCalibrationStepText();
 bool isCalibrationActive();
+void startSweepPhase(CalibrationState state);
+void updateCalibrationSweep();
+void sampleSweepNeutral(int axis, int raw);
+void sampleSweepRange(int axis, int raw);
+int getSweepProgress();
+void handleSweepEvent(const InputEvent& event);
+void finishSweep();
+void applySweepDeadzones();
+void drawSweepScreen();
 
 void initMenuCalibration() {
   calibrationActive = false;
 }
 
-void updateMenuCalibration() {
+void updateMenuCalibration(const InputEvent& event) {
   if (!waitingForOK) return;
+  if (event.type != INPUT_EVENT_PRESS) return;
+  
+  if (currentCalType == CAL_TYPE_SWEEP) {
+    handleSweepEvent(event);
+    return;
+  }
   
   // During calibration, check for both OK button and left joystick button
-  static bool lastOKState = false;
-  static bool lastLeftJoyState = false;
-  bool currentOKState = buttons.btnOK;
-  bool currentLeftJoyState = buttons.leftJoyBtn;
   
   // ADDED: Check for left joystick button press (back/cancel functionality)
-  if (currentLeftJoyState && !lastLeftJoyState) {
+  if (event.input == BTN_LEFT_JOY) {
     Serial.println("Left joystick pressed during calibration - going back");
     
     // Cancel current calibration and go back to appropriate menu
     calibrationActive = false;
     waitingForOK = false;
     calState = CAL_IDLE;
-    
-    // Return to the appropriate parent menu
-    if (currentCalType == "JOYSTICK") {
-      currentMenu = MENU_JOYSTICK_CAL;
-      maxMenuItems = 5;
-    } else if (currentCalType == "POTENTIOMETER") {
-      currentMenu = MENU_POTENTIOMETER_CAL;
-      maxMenuItems = 3;
-    } else {
-      // Default fallback
-      currentMenu = MENU_CALIBRATION;
-      maxMenuItems = 3; // Reduced from 4 after removing MPU6500
-    }
-    
-    menuSelection = 0;
-    menuOffset = 0;
+    returnToCalibrationMenu();
     
     Serial.println("Calibration cancelled - returned to menu");
-    lastLeftJoyState = currentLeftJoyState;
     return;
   }
   
-  // Check for OK button press (rising edge detection) - ORIGINAL FUNCTIONALITY
-  if (currentOKState && !lastOKState) {
+  // Check for OK button press - ORIGINAL FUNCTIONALITY
+  if (event.input == BTN_OK) {
     Serial.println("OK pressed during calibration");
     playCalibrationStepSound();  // ADD THIS LINE
-
     
-    if (currentCalType == "JOYSTICK") {
-      int rawValue = 0;
-      
-      // Read the specific axis
-      if (currentCalAxis == "RIGHT_X") rawValue = analogRead(RIGHT_JOY_X);
-      else if (currentCalAxis == "RIGHT_Y") rawValue = analogRead(RIGHT_JOY_Y);
-      else if (currentCalAxis == "LEFT_X") rawValue = analogRead(LEFT_JOY_X);
-      else if (currentCalAxis == "LEFT_Y") rawValue = analogRead(LEFT_JOY_Y);
-      
-      // Store calibration values for specific axis
-      switch (calState) {
-        case CAL_NEUTRAL:
-          if (currentCalAxis == "RIGHT_X") calData.rightJoyX_neutral = rawValue;
-          else if (currentCalAxis == "RIGHT_Y") calData.rightJoyY_neutral = rawValue;
-          else if (currentCalAxis == "LEFT_X") calData.leftJoyX_neutral = rawValue;
-          else if (currentCalAxis == "LEFT_Y") calData.leftJoyY_neutral = rawValue;
-          calState = CAL_MAX;
-          break;
-        case CAL_MAX:
-          if (currentCalAxis == "RIGHT_X") calData.rightJoyX_max = rawValue;
-          else if (currentCalAxis == "RIGHT_Y") calData.rightJoyY_max = rawValue;
-          else if (currentCalAxis == "LEFT_X") calData.leftJoyX_max = rawValue;
-          else if (currentCalAxis == "LEFT_Y") calData.leftJoyY_max = rawValue;
-          calState = CAL_MIN;
-          break;
-        case CAL_MIN:
-          if (currentCalAxis == "RIGHT_X") {
-            calData.rightJoyX_min = rawValue;
-            calData.rightJoyX_calibrated = true;
-          } else if (currentCalAxis == "RIGHT_Y") {
-            calData.rightJoyY_min = rawValue;
-            calData.rightJoyY_calibrated = true;
-          } else if (currentCalAxis == "LEFT_X") {
-            calData.leftJoyX_min = rawValue;
-            calData.leftJoyX_calibrated = true;
-          } else if (currentCalAxis == "LEFT_Y") {
-            calData.leftJoyY_min = rawValue;
-            calData.leftJoyY_calibrated = true;
-          }
-          completeCalibration();
-          break;
-        default:
-          break;
-      }
-    } else if (currentCalType == "POTENTIOMETER") {
-      int rawValue = 0;
-      
-      if (currentCalAxis == "LEFT") rawValue = analogRead(LEFT_POT);
-      else if (currentCalAxis == "RIGHT") rawValue = analogRead(RIGHT_POT);
-      
-      switch (calState) {
-        case CAL_NEUTRAL:
-          if (currentCalAxis == "LEFT") calData.leftPot_neutral = rawValue;
-          else if (currentCalAxis == "RIGHT") calData.rightPot_neutral = rawValue;
-          calState = CAL_MAX;
-          break;
-        case CAL_MAX:
-          if (currentCalAxis == "LEFT") calData.leftPot_max = rawValue;
-          else if (currentCalAxis == "RIGHT") calData.rightPot_max = rawValue;
-          calState = CAL_MIN;
-          break;
-        case CAL_MIN:
-          if (currentCalAxis == "LEFT") {
-            calData.leftPot_min = rawValue;
-            calData.leftPot_calibrated = true;
-          } else if (currentCalAxis == "RIGHT") {
-            calData.rightPot_min = rawValue;
-            calData.rightPot_calibrated = true;
-          }
-          completeCalibration();
-          break;
-        default:
-          break;
-      }
+    const AxisDescriptor& desc = axisTable[currentCalAxis];
+    AxisCalibration& cal = calData.axes[desc.calSlot];
+    int rawValue = analogRead(desc.pin);
+    
+    // Store calibration values for the axis
+    switch (calState) {
+      case CAL_NEUTRAL:
+        cal.neutral = rawValue;
+        calState = CAL_MAX;
+        break;
+      case CAL_MAX:
+        cal.max = rawValue;
+        calState = CAL_MIN;
+        break;
+      case CAL_MIN:
+        cal.min = rawValue;
+        calData.calibrated[desc.calSlot] = true;
+        completeCalibration();
+        break;
+      default:
+        break;
     }
     
     calStep++;
   }
-  
-  lastOKState = currentOKState;
-  lastLeftJoyState = currentLeftJoyState;
 }
 
-void startCalibration(String calType, String axis) {
+void startAxisCalibration(int axis) {
   Serial.print("Starting calibration: ");
-  Serial.print(calType);
-  if (axis != "") {
-    Serial.print(" - ");
-    Serial.print(axis);
-  }
-  Serial.println();
+  Serial.println(axisTable[axis].label);
   playCalibrationStartSound();  // ADD THIS LINE
-
   
   calibrationActive = true;
-  currentCalType = calType;
+  currentCalType = CAL_TYPE_AXIS;
   currentCalAxis = axis;
   calStep = 0;
   waitingForOK = true;
   currentMenu = MENU_CAL_IN_PROGRESS;
   
-  if (calType == "JOYSTICK" || calType == "POTENTIOMETER") {
-    maxCalSteps = 3; // Neutral, Max, Min
-    calState = CAL_NEUTRAL;
+  maxCalSteps = 3; // Neutral, Max, Min
+  calState = CAL_NEUTRAL;
+}
+
+void startSweepCalibration() {
+  Serial.println("Starting calibration: stick sweep");
+  playCalibrationStartSound();
+  
+  calibrationActive = true;
+  currentCalType = CAL_TYPE_SWEEP;
+  calStep = 0;
+  waitingForOK = true;
+  currentMenu = MENU_CAL_IN_PROGRESS;
+  
+  maxCalSteps = 3; // Neutral, Range, Result
+  startSweepPhase(CAL_SWEEP_NEUTRAL);
+}
+
+// Back to the joystick or potentiometer calibration menu
+void returnToCalibrationMenu() {
+  if (currentCalType == CAL_TYPE_SWEEP || axisTable[currentCalAxis].kind == AXIS_KIND_STICK) {
+    setCurrentMenu(MENU_JOYSTICK_CAL);
+  } else {
+    setCurrentMenu(MENU_POTENTIOMETER_CAL);
   }
 }
 
 void completeCalibration() {
   Serial.print("Calibration complete: ");
-  Serial.print(currentCalType);
-  if (currentCalAxis != "") {
-    Serial.print(" - ");
-    Serial.print(currentCalAxis);
-  }
-  Serial.println();
+  Serial.println(currentCalType == CAL_TYPE_SWEEP ? "stick sweep" : axisTable[currentCalAxis].label);
   
   saveCalibration();
   playCalibrationCompleteSound();  // ADD THIS LINE
   calibrationActive = false;
   
   // Return to appropriate menu
-  if (currentCalType == "JOYSTICK") {
-    currentMenu = MENU_JOYSTICK_CAL;
-    maxMenuItems = 5;
-  } else if (currentCalType == "POTENTIOMETER") {
-    currentMenu = MENU_POTENTIOMETER_CAL;
-    maxMenuItems = 3;
-  } else {
-    currentMenu = MENU_CALIBRATION;
-    maxMenuItems = 3; // Reduced from 4 after removing MPU6500
-  }
-  
-  menuSelection = 0;
-  menuOffset = 0;
+  returnToCalibrationMenu();
   calState = CAL_IDLE;
   
   delay(1000);
@@ -236,10 +208,7 @@ void goBackCalibration() {
   // Return to calibration menu if in progress
   if (calibrationActive) {
     calibrationActive = false;
-    currentMenu = MENU_CALIBRATION;
-    maxMenuItems = 3; // Reduced from 4 after removing MPU6500
-    menuSelection = 0;
-    menuOffset = 0;
+    setCurrentMenu(MENU_CALIBRATION);
   }
 }
 
@@ -252,15 +221,18 @@ void drawMenuCalibration() {
 }
 
 void drawCalibrationScreen() {
+  if (currentCalType == CAL_TYPE_SWEEP) {
+    drawSweepScreen();
+    return;
+  }
+  
+  const AxisDescriptor& desc = axisTable[currentCalAxis];
+  
   // Header
   display.setTextSize(1);
   display.setCursor(0, 0);
   display.print("Cal: ");
-  display.print(currentCalType);
-  if (currentCalAxis != "") {
-    display.print(" ");
-    display.print(currentCalAxis);
-  }
+  display.print(desc.label);
   
   // Progress
   display.setCursor(0, 16);
@@ -274,47 +246,284 @@ void drawCalibrationScreen() {
   display.println(getCalibrationStepText());
   
   // Current value display
-  if (currentCalType == "JOYSTICK") {
-    display.setCursor(0, 42);
-    if (currentCalAxis == "RIGHT_X") {
-      display.print("Value: ");
-      display.print(analogRead(RIGHT_JOY_X));
-    } else if (currentCalAxis == "RIGHT_Y") {
-      display.print("Value: ");
-      display.print(analogRead(RIGHT_JOY_Y));
-    } else if (currentCalAxis == "LEFT_X") {
-      display.print("Value: ");
-      display.print(analogRead(LEFT_JOY_X));
-    } else if (currentCalAxis == "LEFT_Y") {
-      display.print("Value: ");
-      display.print(analogRead(LEFT_JOY_Y));
-    }
-  } else if (currentCalType == "POTENTIOMETER") {
-    display.setCursor(0, 42);
-    if (currentCalAxis == "LEFT") {
-      display.print("Value: ");
-      display.print(analogRead(LEFT_POT));
-    } else if (currentCalAxis == "RIGHT") {
-      display.print("Value: ");
-      display.print(analogRead(RIGHT_POT));
-    }
-  }
+  display.setCursor(0, 42);
+  display.print("Value: ");
+  display.print(analogRead(desc.pin));
   
   // Show both OK and Back instructions
   display.setCursor(0, 52);
   display.print("OK: Continue");
 }
 
-String getCalibrationStepText() {
-  if (currentCalType == "JOYSTICK" || currentCalType == "POTENTIOMETER") {
-    switch (calState) {
-      case CAL_NEUTRAL: return "Move to CENTER";
-      case CAL_MAX: return "Move to MAXIMUM";
-      case CAL_MIN: return "Move to MINIMUM";
-      default: return "Unknown";
+const char* getCalibrationStepText() {
+  switch (calState) {
+    case CAL_NEUTRAL: return "Move to CENTER";
+    case CAL_MAX: return "Move to MAXIMUM";
+    case CAL_MIN: return "Move to MINIMUM";
+    default: return "Unknown";
+  }
+}
+
+// ================== SWEEP CALIBRATION ==================
+
+void startSweepPhase(CalibrationState state) {
+  calState = state;
+  sweepPhaseStart = millis();
+  sweepLastSampleMicros = micros();
+  sweepSampleCount = 0;
+  
+  for (int axis = 0; axis < SWEEP_AXES; axis++) {
+    SweepAxisStats& stats = sweepStats[axis];
+    int raw = analogRead(axisTable[axis].pin);
+    if (state == CAL_SWEEP_NEUTRAL) {
+      resetRunningStats(stats.neutral);
+      stats.rejected = 0;
+      stats.peakDeviation = 0;
+    }
+    stats.history[0] = raw;
+    stats.history[1] = raw;
+    stats.minValue = raw;
+    stats.maxValue = raw;
+    sweepCurrent[axis] = raw;
+  }
+}
+
+// Called from updateMenu() on every pass - samples all axes at up to 1 kHz
+void updateCalibrationSweep() {
+  if (currentCalType != CAL_TYPE_SWEEP) return;
+  if (calState != CAL_SWEEP_NEUTRAL && calState != CAL_SWEEP_RANGE) return;
+  
+  uint32_t now = micros();
+  if (now - sweepLastSampleMicros < SWEEP_SAMPLE_US) return;
+  sweepLastSampleMicros = now;
+  
+  if (calState == CAL_SWEEP_NEUTRAL && millis() - sweepPhaseStart < SWEEP_SETTLE_MS) return;
+  
+  for (int axis = 0; axis < SWEEP_AXES; axis++) {
+    int raw = analogRead(axisTable[axis].pin);
+    sweepCurrent[axis] = raw;
+    if (calState == CAL_SWEEP_NEUTRAL) sampleSweepNeutral(axis, raw);
+    else sampleSweepRange(axis, raw);
+  }
+  sweepSampleCount++;
+  
+  if (calState == CAL_SWEEP_NEUTRAL && millis() - sweepPhaseStart >= SWEEP_SETTLE_MS + SWEEP_NEUTRAL_MS) {
+    // A stick that moved while resting invalidates the neutral
+    for (int axis = 0; axis < SWEEP_AXES; axis++) {
+      if (getRunningStdDev(sweepStats[axis].neutral) > SWEEP_MAX_NOISE) {
+        Serial.print("Sweep: ");
+        Serial.print(axisTable[axis].shortLabel);
+        Serial.println(" moved during neutral sampling - restarting");
+        playErrorSound();
+        startSweepPhase(CAL_SWEEP_NEUTRAL);
+        return;
+      }
+    }
+    
+    Serial.print("Sweep neutral: ");
+    Serial.print(sweepSampleCount * 1000UL / SWEEP_NEUTRAL_MS);
+    Serial.println(" samples/s");
+    for (int axis = 0; axis < SWEEP_AXES; axis++) {
+      Serial.print("  ");
+      Serial.print(axisTable[axis].shortLabel);
+      Serial.print(" mean ");
+      Serial.print(sweepStats[axis].neutral.mean, 1);
+      Serial.print(" sigma ");
+      Serial.print(getRunningStdDev(sweepStats[axis].neutral), 2);
+      Serial.print(" rejected ");
+      Serial.println(sweepStats[axis].rejected);
+    }
+    
+    playCalibrationStepSound();
+    calStep++;
+    startSweepPhase(CAL_SWEEP_RANGE);
+  }
+}
+
+// Running mean/variance with outlier rejection around the running mean
+void sampleSweepNeutral(int axis, int raw) {
+  SweepAxisStats& stats = sweepStats[axis];
+  
+  if (stats.neutral.count >= SWEEP_WARMUP_SAMPLES) {
+    float band = SWEEP_OUTLIER_SIGMA * max(getRunningStdDev(stats.neutral), SWEEP_MIN_NOISE);
+    if (fabsf(raw - stats.neutral.mean) > band) {
+      stats.rejected++;
+      return;
+    }
+  }
+  
+  addRunningSample(stats.neutral, raw);
+  
+  if (stats.neutral.count >= SWEEP_WARMUP_SAMPLES) {
+    int peak = (int)(fabsf(raw - stats.neutral.mean) + 0.5f);
+    if (peak > stats.peakDeviation) stats.peakDeviation = peak;
+  }
+}
+
+// Running min/max of the median of the last three samples - single-sample spikes never become an extreme
+void sampleSweepRange(int axis, int raw) {
+  SweepAxisStats& stats = sweepStats[axis];
+  int a = stats.history[0];
+  int b = stats.history[1];
+  int median = max(min(a, b), min(max(a, b), raw));
+  stats.history[0] = b;
+  stats.history[1] = raw;
+  
+  if (median < stats.minValue) stats.minValue = median;
+  if (median > stats.maxValue) stats.maxValue = median;
+}
+
+// Coverage of the least-swept axis, 0-100%
+int getSweepProgress() {
+  int progress = 100;
+  for (int axis = 0; axis < SWEEP_AXES; axis++) {
+    int below = (int)sweepStats[axis].neutral.mean - sweepStats[axis].minValue;
+    int above = sweepStats[axis].maxValue - (int)sweepStats[axis].neutral.mean;
+    int span = 2 * min(below, above);  // Both sides of neutral must be covered
+    progress = min(progress, constrain(span * 100 / SWEEP_FULL_SPAN, 0, 100));
+  }
+  return progress;
+}
+
+void handleSweepEvent(const InputEvent& event) {
+  if (event.input == BTN_LEFT_JOY) {
+    if (calState == CAL_SWEEP_RESULT) {
+      // Calibration is already saved - keep the current deadzones
+      Serial.println("Sweep: keeping current deadzones");
+      completeCalibration();
+    } else {
+      Serial.println("Sweep calibration cancelled - nothing saved");
+      calibrationActive = false;
+      waitingForOK = false;
+      calState = CAL_IDLE;
+      returnToCalibrationMenu();
+    }
+    return;
+  }
+  
+  if (event.input != BTN_OK) return;
+  
+  if (calState == CAL_SWEEP_RANGE) {
+    if (getSweepProgress() < 100) {
+      Serial.println("Sweep: move every stick to all edges first");
+      playErrorSound();
+      return;
+    }
+    playCalibrationStepSound();
+    finishSweep();
+  } else if (calState == CAL_SWEEP_RESULT) {
+    applySweepDeadzones();
+    completeCalibration();
+  }
+}
+
+void finishSweep() {
+  for (int axis = 0; axis < SWEEP_AXES; axis++) {
+    SweepAxisStats& stats = sweepStats[axis];
+    const AxisDescriptor& desc = axisTable[axis];
+    int neutral = (int)(stats.neutral.mean + 0.5f);
+    AxisCalibration& cal = calData.axes[desc.calSlot];
+    
+    // Keep the axis direction: an inverted axis stores its low raw end as max,
+    // the same as the point calibration and the uncalibrated mapping
+    cal.min = desc.inverted ? stats.maxValue : stats.minValue;
+    cal.neutral = neutral;
+    cal.max = desc.inverted ? stats.minValue : stats.maxValue;
+    calData.calibrated[desc.calSlot] = true;
+    
+    // Worst-case noise (4 sigma or the largest accepted deviation) in -1000..+1000 units
+    int noiseCounts = max((int)ceilf(4 * getRunningStdDev(stats.neutral)), stats.peakDeviation);
+    int halfSpan = min(neutral - stats.minValue, stats.maxValue - neutral);
+    int deadzone = (noiseCounts * 1000 + halfSpan - 1) / halfSpan + SWEEP_DZ_MARGIN;
+    stats.recommendedDeadzone = min(DEADZONE_MAX, (deadzone + 4) / 5 * 5);
+    
+    Serial.print("Sweep ");
+    Serial.print(axisTable[axis].shortLabel);
+    Serial.print(": min ");
+    Serial.print(stats.minValue);
+    Serial.print(" neutral ");
+    Serial.print(neutral);
+    Serial.print(" max ");
+    Serial.print(stats.maxValue);
+    Serial.print(" noise ");
+    Serial.print(noiseCounts);
+    Serial.print(" counts, recommended deadzone ");
+    Serial.println(stats.recommendedDeadzone);
+  }
+  
+  saveCalibration();
+  calStep++;
+  calState = CAL_SWEEP_RESULT;
+}
+
+void applySweepDeadzones() {
+  for (int axis = 0; axis < SWEEP_AXES; axis++) {
+    if (axisTable[axis].deadzoneAxis >= 0) {
+      deadzoneData.deadzone[axisTable[axis].deadzoneAxis] = sweepStats[axis].recommendedDeadzone;
+    }
+  }
+  saveDeadzones();
+  compileDeadzones();
+}
+
+void drawSweepScreen() {
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  
+  if (calState == CAL_SWEEP_NEUTRAL) {
+    display.println("Sweep: Release sticks");
+    
+    // Time progress
+    unsigned long elapsed = millis() - sweepPhaseStart;
+    int barWidth = map(constrain(elapsed, 0, SWEEP_SETTLE_MS + SWEEP_NEUTRAL_MS), 0, SWEEP_SETTLE_MS + SWEEP_NEUTRAL_MS, 0, 100);
+    display.drawRect(10, 12, 102, 6, SSD1306_WHITE);
+    display.fillRect(11, 13, barWidth, 4, SSD1306_WHITE);
+    
+    for (int axis = 0; axis < SWEEP_AXES; axis++) {
+      display.setCursor(0, 22 + axis * 8);
+      display.print(axisTable[axis].shortLabel);
+      display.print(" ");
+      display.print(sweepCurrent[axis]);
+      display.setCursor(54, 22 + axis * 8);
+      display.print("noise ");
+      display.print(getRunningStdDev(sweepStats[axis].neutral), 1);
+    }
+    
+  } else if (calState == CAL_SWEEP_RANGE) {
+    display.print("Move to all edges ");
+    display.print(getSweepProgress());
+    display.print("%");
+    
+    // Per axis: swept span as a bar over the full ADC range, current value as a tick
+    for (int axis = 0; axis < SWEEP_AXES; axis++) {
+      int y = 12 + axis * 10;
+      display.setCursor(0, y);
+      display.print(axisTable[axis].shortLabel);
+      display.drawRect(16, y, 110, 7, SSD1306_WHITE);
+      int x0 = 17 + map(sweepStats[axis].minValue, 0, 1023, 0, 107);
+      int x1 = 17 + map(sweepStats[axis].maxValue, 0, 1023, 0, 107);
+      display.fillRect(x0, y + 2, max(1, x1 - x0), 3, SSD1306_WHITE);
+      int xc = 17 + map(sweepCurrent[axis], 0, 1023, 0, 107);
+      display.drawFastVLine(xc, y, 7, SSD1306_WHITE);
+    }
+    
+    display.setCursor(0, 54);
+    display.print(getSweepProgress() >= 100 ? "OK: Finish" : "Full circles...");
+    
+  } else if (calState == CAL_SWEEP_RESULT) {
+    display.println("Saved. Noise / DZ:");
+    for (int axis = 0; axis < SWEEP_AXES; axis++) {
+      display.setCursor(0, 10 + axis * 9);
+      display.print(axisTable[axis].shortLabel);
+      display.print(" ");
+      display.print(getRunningStdDev(sweepStats[axis].neutral), 1);
+      display.setCursor(60, 10 + axis * 9);
+      display.print("DZ ");
+      display.print(sweepStats[axis].recommendedDeadzone);
     }
+    display.setCursor(0, 54);
+    display.print("OK:Apply DZ LJ:Keep");
   }
-  return "Unknown";
 }
 
 #endif
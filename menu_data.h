@@ -8,6 +8,12 @@
 
 #include <EEPROM.h>
 #include "config.h"
+#include "curves.h"
+#include "deadzone.h"
+#include "trims.h"
+#include "slew.h"
+#include "axes.h"
+#include "logic_switches.h"
 
 // Menu states (enhanced with audio settings)
 enum MenuState {
@@ -42,7 +48,16 @@ enum MenuState {
   MENU_FACTORY_RESET_FINAL,      // Final factory reset confirmation
   MENU_FACTORY_RESET_PROGRESS,    // Factory reset progress animation
   MENU_DISPLAY_TEST,
-  MENU_BUTTON_TEST        // Input test menu
+  MENU_BUTTON_TEST,       // Input test menu
+  MENU_CURVES,                   // Curves & rates menu
+  MENU_CURVE_CHANNEL,            // Per-channel curve menu
+  MENU_CURVE_EXPO_SETTING,       // Expo percentage
+  MENU_CURVE_RATE_HIGH_SETTING,  // High rate percentage
+  MENU_CURVE_RATE_LOW_SETTING,   // Low rate percentage
+  MENU_CURVE_POINTS_SETTING,     // Multi-point curve editor
+  MENU_LOGIC_SWITCHES,           // Logic switch list
+  MENU_LOGIC_SWITCH_SETTING,     // Logic switch editor
+  MENU_STATE_COUNT
 };
 
 // LED Color modes
@@ -60,16 +75,59 @@ enum CalibrationState {
   CAL_NEUTRAL,
   CAL_MAX,
   CAL_MIN,
-  CAL_COMPLETE
+  CAL_COMPLETE,
+  CAL_SWEEP_NEUTRAL,    // Sweep: sampling the resting sticks
+  CAL_SWEEP_RANGE,      // Sweep: user moves the sticks to every edge
+  CAL_SWEEP_RESULT      // Sweep: showing noise and recommended deadzones
 };
 
-// Menu item structure
+// Live part of a menu line - a literal or a static buffer, valid until the next call
+typedef const char* (*MenuStatusFn)(int arg);
+
+typedef void (*MenuHandlerFn)(int arg);
+
+// What selecting a menu item does
+enum MenuAction {
+  MENU_ACTION_NONE = 0,   // Information line
+  MENU_ACTION_SUBMENU,    // Open the target node (runs its enter hook)
+  MENU_ACTION_EDIT,       // Open the target editor through startSetting()
+  MENU_ACTION_CALL,       // Run the handler and stay on this node
+  MENU_ACTION_BACK,
+  MENU_ACTION_EXIT
+};
+
+// Menu item structure - menus are constexpr tables, the status text is formatted at draw time
 struct MenuItem {
-  String title;
+  const char* title;
+  MenuStatusFn status;     // Appended to title, NULL = fixed text
+  MenuHandlerFn handler;   // CALL action, or runs before SUBMENU/EDIT to pick what is opened
+  int8_t arg;              // Passed to status and handler
+  uint8_t action;          // MenuAction
+  uint8_t target;          // MenuState opened by SUBMENU/EDIT
   bool enabled;
   bool hasSubmenu;
 };
 
+// One node per MenuState - item counts, Back targets and drawing all come from
+// menuNodes[] (menu_tree.h), indexed by the state
+struct MenuNode {
+  uint8_t state;           // Must equal the table index (checked at compile time)
+  uint8_t parent;          // MenuState Back returns to
+  const MenuItem* items;   // NULL = screen drawn by its subsystem (editor, test, calibration)
+  uint8_t itemCount;
+  const char* header;
+  MenuStatusFn headerStatus;  // Appended to header
+  void (*draw)();          // Custom screen for the items (dialogs), NULL = scrollable list
+  void (*enter)();         // Runs when the node is opened through SUBMENU
+  void (*leave)();         // Runs when the node is left through Back
+};
+
+#define MENU_ITEM_COUNT(items) ((int)(sizeof(items) / sizeof(items[0])))
+
+// Menu tree access (menu_tree.h)
+const MenuNode& getMenuNode(int state);
+void setCurrentMenu(int state);
+
 // Enhanced settings data structure with audio settings
 struct SettingsData {
   // Joystick settings
@@ -114,22 +172,18 @@ struct SettingsData {
   uint16_t signature;
 };
 
+// Per-axis calibration (raw ADC counts)
+struct AxisCalibration {
+  int min, neutral, max;
+};
+
 // Calibration data structure (MPU6500 fields removed)
+// Slots follow the AxisId order of axisTable, which matches the old per-axis field layout
 struct CalibrationData {
-  // Individual joystick axis calibration
-  int rightJoyX_min, rightJoyX_neutral, rightJoyX_max;
-  int rightJoyY_min, rightJoyY_neutral, rightJoyY_max;
-  int leftJoyX_min, leftJoyX_neutral, leftJoyX_max;
-  int leftJoyY_min, leftJoyY_neutral, leftJoyY_max;
-  
-  // Individual potentiometer calibration
-  int leftPot_min, leftPot_neutral, leftPot_max;
-  int rightPot_min, rightPot_neutral, rightPot_max;
+  AxisCalibration axes[NUM_AXES];
   
   // Individual calibration validity flags
-  bool rightJoyX_calibrated, rightJoyY_calibrated;
-  bool leftJoyX_calibrated, leftJoyY_calibrated;
-  bool leftPot_calibrated, rightPot_calibrated;
+  bool calibrated[NUM_AXES];
   
   // EEPROM signature
   uint16_t signature;
@@ -167,14 +221,11 @@ void applyDisplayBrightness();
 void applyAudioSettings();  // NEW: Apply audio settings
 void updateDataPacketRanges();
 int getCurrentDeadzone();
-String getCalibrationStatus(String axis);
+const char* getCalibrationStatus(int axis);
 int getCalibratedValue(int rawValue, int minVal, int neutralVal, int maxVal);
-int getCalibratedSteering();
-int getCalibratedThrottle();
-int getCalibratedRightJoyY();
-int getCalibratedLeftJoyX();
-int getCalibratedLeftPot();
-int getCalibratedRightPot();
+int getCalibratedAxis(int axis);
+int calibrateAxis(int axis, int raw);
+void resetAxisCalibration(int axis);
 int freeMemory();
 
 // Factory reset function declarations
@@ -202,6 +253,12 @@ void initMenuData() {
   
   loadCalibration();
   loadSettings();
+  initCurves();  // Load and compile expo/rate curves
+  initMixer();   // Load the mixer matrix
+  initDeadzones(settings.joystickDeadzone);  // Per-axis deadzones (seeded from the old setting)
+  initTrims(settings.radioAddress);          // Trims of the model bound to this radio address
+  initSlew();    // Per-channel slew rates
+  initLogicSwitches();  // Logic switch definitions, compiled to bytecode
   
   // CRITICAL FIX: Apply audio settings IMMEDIATELY after loading from EEPROM
   // This ensures audio system gets the correct enabled/disabled state before any sounds play
@@ -362,19 +419,10 @@ void loadCalibration() {
 }
 
 void resetCalibration() {
-  // Set default values for all axes
-  calData.rightJoyX_min = 0; calData.rightJoyX_neutral = 512; calData.rightJoyX_max = 1023;
-  calData.rightJoyY_min = 0; calData.rightJoyY_neutral = 512; calData.rightJoyY_max = 1023;
-  calData.leftJoyX_min = 0; calData.leftJoyX_neutral = 512; calData.leftJoyX_max = 1023;
-  calData.leftJoyY_min = 0; calData.leftJoyY_neutral = 512; calData.leftJoyY_max = 1023;
-  
-  calData.leftPot_min = 0; calData.leftPot_neutral = 512; calData.leftPot_max = 1023;
-  calData.rightPot_min = 0; calData.rightPot_neutral = 512; calData.rightPot_max = 1023;
-  
-  // Reset all calibration flags
-  calData.rightJoyX_calibrated = false; calData.rightJoyY_calibrated = false;
-  calData.leftJoyX_calibrated = false; calData.leftJoyY_calibrated = false;
-  calData.leftPot_calibrated = false; calData.rightPot_calibrated = false;
+  // Set default values and clear the calibration flag for all axes
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    resetAxisCalibration(axis);
+  }
   
   calData.signature = EEPROM_SIGNATURE;
 }
@@ -432,14 +480,16 @@ int getCurrentDeadzone() {
   return settings.joystickDeadzone;
 }
 
-String getCalibrationStatus(String axis) {
-  if (axis == "RIGHT_X") return calData.rightJoyX_calibrated ? "[OK]" : "[--]";
-  if (axis == "RIGHT_Y") return calData.rightJoyY_calibrated ? "[OK]" : "[--]";
-  if (axis == "LEFT_X") return calData.leftJoyX_calibrated ? "[OK]" : "[--]";
-  if (axis == "LEFT_Y") return calData.leftJoyY_calibrated ? "[OK]" : "[--]";
-  if (axis == "LEFT_POT") return calData.leftPot_calibrated ? "[OK]" : "[--]";
-  if (axis == "RIGHT_POT") return calData.rightPot_calibrated ? "[OK]" : "[--]";
-  return "[--]";
+const char* getCalibrationStatus(int axis) {
+  return calData.calibrated[axisTable[axis].calSlot] ? "[OK]" : "[--]";
+}
+
+void resetAxisCalibration(int axis) {
+  AxisCalibration& cal = calData.axes[axisTable[axis].calSlot];
+  cal.min = factoryDefaults.axisMin;
+  cal.neutral = factoryDefaults.axisNeutral;
+  cal.max = factoryDefaults.axisMax;
+  calData.calibrated[axisTable[axis].calSlot] = false;
 }
 
 // Calibrated value functions
@@ -451,90 +501,29 @@ int getCalibratedValue(int rawValue, int minVal, int neutralVal, int maxVal) {
   }
 }
 
-int getCalibratedSteering() {
-  if (!calData.rightJoyX_calibrated) {
-    return map(analogRead(RIGHT_JOY_X), 0, 1023, 1000, -1000);
-  }
-  int value = getCalibratedValue(analogRead(RIGHT_JOY_X), 
-                                calData.rightJoyX_min, 
-                                calData.rightJoyX_neutral, 
-                                calData.rightJoyX_max);
-  // Apply deadzone
-  if (abs(value) < settings.joystickDeadzone) value = 0;
-  return value;
-}
-
-int getCalibratedThrottle() {
-  if (!calData.leftJoyY_calibrated) {
-    return map(analogRead(LEFT_JOY_Y), 0, 1023, -1000, 1000);
-  }
-  int value = getCalibratedValue(analogRead(LEFT_JOY_Y), 
-                                calData.leftJoyY_min, 
-                                calData.leftJoyY_neutral, 
-                                calData.leftJoyY_max);
-  // Apply deadzone
-  if (abs(value) < settings.joystickDeadzone) value = 0;
-  return value;
-}
-
-// Additional calibrated functions for future use
-int getCalibratedRightJoyY() {
-  if (!calData.rightJoyY_calibrated) {
-    return map(analogRead(RIGHT_JOY_Y), 0, 1023, -1000, 1000);
-  }
-  return getCalibratedValue(analogRead(RIGHT_JOY_Y), 
-                           calData.rightJoyY_min, 
-                           calData.rightJoyY_neutral, 
-                           calData.rightJoyY_max);
-}
-
-int getCalibratedLeftJoyX() {
-  if (!calData.leftJoyX_calibrated) {
-    return map(analogRead(LEFT_JOY_X), 0, 1023, -1000, 1000);
-  }
-  return getCalibratedValue(analogRead(LEFT_JOY_X), 
-                           calData.leftJoyX_min, 
-                           calData.leftJoyX_neutral, 
-                           calData.leftJoyX_max);
+// Any analog axis in -1000..+1000 - the default full-range mapping until it has been calibrated
+int getCalibratedAxis(int axis) {
+  return calibrateAxis(axis, analogRead(axisTable[axis].pin));
 }
 
-int getCalibratedLeftPot() {
-  if (!calData.leftPot_calibrated) {
-    return map(analogRead(LEFT_POT), 0, 1023, -1000, 1000);
+// Map a raw (or averaged) ADC reading through the axis calibration
+int calibrateAxis(int axis, int raw) {
+  const AxisDescriptor& desc = axisTable[axis];
+  if (!calData.calibrated[desc.calSlot]) {
+    return desc.inverted ? map(raw, 0, 1023, 1000, -1000) : map(raw, 0, 1023, -1000, 1000);
   }
-  return getCalibratedValue(analogRead(LEFT_POT), 
-                           calData.leftPot_min, 
-                           calData.leftPot_neutral, 
-                           calData.leftPot_max);
-}
-
-int getCalibratedRightPot() {
-  if (!calData.rightPot_calibrated) {
-    return map(analogRead(RIGHT_POT), 0, 1023, -1000, 1000);
-  }
-  return getCalibratedValue(analogRead(RIGHT_POT), 
-                           calData.rightPot_min, 
-                           calData.rightPot_neutral, 
-                           calData.rightPot_max);
+  const AxisCalibration& cal = calData.axes[desc.calSlot];
+  return getCalibratedValue(raw, cal.min, cal.neutral, cal.max);
 }
 
 // Utility function to get free memory - Teensy specific implementation
 int freeMemory() {
-  // Teensy 4.0 has much more RAM (1MB) than Arduino Mega
-  // This is an approximate implementation for compatibility
-  uint32_t stackTop;
-  uint32_t heapTop;
-  
-  // Current position of the stack
-  stackTop = (uint32_t)&stackTop;
-  
-  // Current position of heap
-  void* hTop = malloc(1);
-  heapTop = (uint32_t)hTop;
-  free(hTop);
-  
-  // The free space is approximately the difference between heap and stack
-  return (stackTop - heapTop);
+  // Teensy 4.0 keeps the heap in RAM2, from _heap_start up to _heap_end.
+  // Read the break pointer instead of malloc()ing a probe byte - this runs
+  // on every System Info frame. Freed blocks below the break are not counted.
+  extern unsigned long _heap_end;
+  extern char* __brkval;
+  return (char*)&_heap_end - __brkval;
 }
 
 // Factory reset functions
@@ -565,14 +554,7 @@ void updateFactoryReset() {
       Serial.println("Factory reset completed!");
       
       // Return to main menu
-      extern MenuState currentMenu;
-      extern int maxMenuItems;
-      extern int menuSelection;
-      extern int menuOffset;
-      currentMenu = MENU_MAIN;
-      maxMenuItems = 8;
-      menuSelection = 0;
-      menuOffset = 0;
+      setCurrentMenu(MENU_MAIN);
     }
   }
 }
@@ -625,39 +607,34 @@ void performFactoryReset() {
   
   settings.signature = EEPROM_SIGNATURE;
   
-  // Apply factory defaults to calibration
-  calData.rightJoyX_min = factoryDefaults.rightJoyX_min;
-  calData.rightJoyX_neutral = factoryDefaults.rightJoyX_neutral;
-  calData.rightJoyX_max = factoryDefaults.rightJoyX_max;
-  calData.rightJoyY_min = factoryDefaults.rightJoyY_min;
-  calData.rightJoyY_neutral = factoryDefaults.rightJoyY_neutral;
-  calData.rightJoyY_max = factoryDefaults.rightJoyY_max;
-  calData.leftJoyX_min = factoryDefaults.leftJoyX_min;
-  calData.leftJoyX_neutral = factoryDefaults.leftJoyX_neutral;
-  calData.leftJoyX_max = factoryDefaults.leftJoyX_max;
-  calData.leftJoyY_min = factoryDefaults.leftJoyY_min;
-  calData.leftJoyY_neutral = factoryDefaults.leftJoyY_neutral;
-  calData.leftJoyY_max = factoryDefaults.leftJoyY_max;
-  calData.leftPot_min = factoryDefaults.leftPot_min;
-  calData.leftPot_neutral = factoryDefaults.leftPot_neutral;
-  calData.leftPot_max = factoryDefaults.leftPot_max;
-  calData.rightPot_min = factoryDefaults.rightPot_min;
-  calData.rightPot_neutral = factoryDefaults.rightPot_neutral;
-  calData.rightPot_max = factoryDefaults.rightPot_max;
-  
-  // Reset calibration flags (all uncalibrated)
-  calData.rightJoyX_calibrated = false;
-  calData.rightJoyY_calibrated = false;
-  calData.leftJoyX_calibrated = false;
-  calData.leftJoyY_calibrated = false;
-  calData.leftPot_calibrated = false;
-  calData.rightPot_calibrated = false;
+  // Apply factory defaults to calibration (all uncalibrated)
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    resetAxisCalibration(axis);
+  }
   
   calData.signature = EEPROM_SIGNATURE;
   
+  // Reset curves and rates to linear, mixer to direct, deadzones to the default, trims to centre, slew and logic switches off
+  resetCurves();
+  resetMixer();
+  resetDeadzones(settings.joystickDeadzone);
+  compileDeadzones();
+  resetTrims();
+  selectTrimModel(settings.radioAddress);
+  resetSlew();
+  resetLogicSwitches();
+  compileLogicSwitches();
+  
   // Save to EEPROM
   saveSettings();
   saveCalibration();
+  saveCurves();
+  compileCurves();
+  saveMixer();
+  saveDeadzones();
+  saveTrimsNow();
+  saveSlew();
+  saveLogicSwitches();
   
   // Apply settings immediately
   applyLEDSettings();
@@ -687,7 +664,7 @@ void drawFactoryResetScreen() {
   if (overallProgress > 1.0) overallProgress = 1.0;
   
   // Step text - positioned in yellow region (0-15 pixels)
-  String stepText;
+  const char* stepText;
   switch (factoryResetStep) {
     case 0: stepText = "Clearing Settings"; break;
     case 1: stepText = "Creating Settings"; break;
@@ -696,7 +673,7 @@ void drawFactoryResetScreen() {
   }
   
   // Center the step text in yellow region
-  int textWidth = stepText.length() * 6;
+  int textWidth = strlen(stepText) * 6;
   int textX = (SCREEN_WIDTH - textWidth) / 2;
   display.setCursor(textX, 4); // Y=4 to center in yellow region (0-15)
   display.println(stepText);
@@ -717,8 +694,9 @@ void drawFactoryResetScreen() {
   }
   
   // Percentage text - positioned in blue region
-  String percentText = String((int)(overallProgress * 100)) + "%";
-  int percentWidth = percentText.length() * 6;
+  char percentText[8];
+  snprintf(percentText, sizeof(percentText), "%d%%", (int)(overallProgress * 100));
+  int percentWidth = strlen(percentText) * 6;
   int percentX = (SCREEN_WIDTH - percentWidth) / 2;
   display.setCursor(percentX, 40); // Blue region
   display.println(percentText);
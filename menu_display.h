@@ -19,236 +19,76 @@
 // External variables from menu.h
 extern int menuSelection;
 extern int menuOffset;
-extern int maxMenuItems;
 extern int maxVisibleItems;
 extern MenuState currentMenu;
 extern bool cancelConfirmActive;
 extern int cancelSelection;
+extern int curveEditChannel;
+
+// Menu line status values
+enum MenuRangeField {
+  MENU_RANGE_THROTTLE_MIN = 0,
+  MENU_RANGE_THROTTLE_MAX,
+  MENU_RANGE_STEER_MIN,
+  MENU_RANGE_STEER_NEUTRAL,
+  MENU_RANGE_STEER_MAX
+};
+
+enum MenuFlag {
+  MENU_FLAG_AUDIO = 0,
+  MENU_FLAG_SYSTEM_SOUNDS,
+  MENU_FLAG_NAVIGATION_SOUNDS,
+  MENU_FLAG_ALERT_SOUNDS,
+  MENU_FLAG_MUSIC,
+  MENU_FLAG_LED,
+  MENU_FLAG_FAILSAFE
+};
+
+enum MenuCurveField {
+  MENU_CURVE_EXPO = 0,
+  MENU_CURVE_RATE_HIGH,
+  MENU_CURVE_RATE_LOW,
+  MENU_CURVE_TYPE,
+  MENU_CURVE_SLEW
+};
 
 // Function declarations
 void drawMainMenus();
-void drawScrollableMenu(MenuItem* items, int itemCount, String header);
+void drawScrollableMenu(const MenuItem* items, int itemCount, const char* header);
 void drawScrollbar(int totalItems, int visibleItems, int offset);
 void drawCancelConfirmation();
+void drawFactoryResetConfirm();
+void drawFactoryResetFinal();
+bool* getMenuFlag(int flag);
+const char* getMenuFlagName(int flag);
+const char* menuStatusCalibration(int axis);
+const char* menuStatusRange(int field);
+const char* menuStatusFlag(int flag);
+const char* menuStatusVolume(int arg);
+const char* menuStatusFailsafe(int axis);
+const char* menuStatusRateSwitch(int arg);
+const char* menuStatusMixer(int arg);
+const char* menuStatusLogicSwitch(int index);
+const char* menuStatusCurve(int field);
+const char* menuStatusFreeMemory(int arg);
+const char* menuStatusCurveChannel(int arg);
 
+// Shared by the status callbacks - each result is printed before the next call
+char menuStatusText[24];
+
+// Draw the current node - list menus straight from its table, dialogs through their draw hook
 void drawMainMenus() {
-  switch (currentMenu) {
-    case MENU_MAIN: {
-      MenuItem items[] = {
-        {"Calibration", true, true},
-        {"Settings", true, true},
-        {"Range Settings", true, true},
-        {"Audio Settings", true, true},    // NEW: Audio Settings menu item
-        {"System Info", true, true},
-        {"Radio Test", true, false},
-        {"Display Test", true, false},
-        {"Input Test", true, false},
-        {"Factory Reset", true, true},
-        {"Exit", true, false}
-      };
-      drawScrollableMenu(items, 10, "RC TX MENU");  // Changed from 9 to 10
-      break;
-    }
-    
-    case MENU_CALIBRATION: {
-      MenuItem items[] = {
-        {"Joystick Cal", true, true},
-        {"Potentiometer Cal", true, true},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 3, "Calibration"); // Reduced from 4 after removing MPU6500
-      break;
-    }
-    
-    case MENU_JOYSTICK_CAL: {
-      MenuItem items[] = {
-        {"Right X " + getCalibrationStatus("RIGHT_X"), true, false},
-        {"Right Y " + getCalibrationStatus("RIGHT_Y"), true, false},
-        {"Left X " + getCalibrationStatus("LEFT_X"), true, false},
-        {"Left Y " + getCalibrationStatus("LEFT_Y"), true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 5, "Joystick Cal");
-      break;
-    }
-    
-    case MENU_POTENTIOMETER_CAL: {
-      MenuItem items[] = {
-        {"Left Pot " + getCalibrationStatus("LEFT_POT"), true, false},
-        {"Right Pot " + getCalibrationStatus("RIGHT_POT"), true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 3, "Potentiometer Cal");
-      break;
-    }
-    
-    case MENU_SETTINGS: {
-      MenuItem items[] = {
-        {"Joystick Deadzone", true, false},
-        {"Display Brightness", true, false},
-        {"LED Settings", true, true},
-        {"Radio Address", true, false},
-        {"Radio Channel", true, false},
-        {"Failsafe Settings", true, true},
-        {"Reset to Defaults", true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 8, "Settings");
-      break;
-    }
-    
-    // Range Settings Menu
-    case MENU_RANGE_SETTINGS: {
-      MenuItem items[] = {
-        {"Throttle Min: " + String(settings.throttleMinPWM) + "us", true, false},
-        {"Throttle Max: " + String(settings.throttleMaxPWM) + "us", true, false},
-        {"Steer Min: " + String(settings.steerMinDegree) + "°", true, false},
-        {"Steer Neutral: " + String(settings.steerNeutralDegree) + "°", true, false},
-        {"Steer Max: " + String(settings.steerMaxDegree) + "°", true, false},
-        {"Reset to Defaults", true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 7, "Range Settings");
-      break;
-    }
-    
-    // NEW: Audio Settings Menu
-    case MENU_AUDIO_SETTINGS: {
-      MenuItem items[] = {
-        {"Audio Enable: " + String(settings.audioEnabled ? "ON" : "OFF"), true, false},
-        {"Volume: " + String(settings.audioVolume) + "%", true, false},
-        {"System Sounds: " + String(settings.systemSounds ? "ON" : "OFF"), true, false},
-        {"Navigation: " + String(settings.navigationSounds ? "ON" : "OFF"), true, false},
-        {"Alert Sounds: " + String(settings.alertSounds ? "ON" : "OFF"), true, false},
-        {"Music Enable: " + String(settings.musicEnabled ? "ON" : "OFF"), true, false},
-        {"Test Sound", true, false},
-        {"Reset Audio", true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 9, "Audio Settings");
-      break;
-    }
-    
-    case MENU_LED_SETTINGS: {
-      MenuItem items[] = {
-        {"LED Enable: " + String(settings.ledEnabled ? "ON" : "OFF"), true, false},
-        {"Armed Color", true, false},
-        {"Disarmed Color", true, false},
-        {"Transmit Color", true, false},
-        {"Error Color", true, false},
-        {"Menu Color", true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 7, "LED Settings");
-      break;
-    }
-    
-    case MENU_FAILSAFE_SETTINGS: {
-      MenuItem items[] = {
-        {"Enable: " + String(settings.failsafeEnabled ? "ON" : "OFF"), true, false},
-        {"Set Throttle: " + String(settings.failsafeThrottle), true, false},
-        {"Set Steering: " + String(settings.failsafeSteering), true, false},
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 4, "Failsafe");
-      break;
-    }
-    
-    case MENU_INFO: {
-      MenuItem items[] = {
-        {"Firmware v3.2", false, false},  // Updated version number
-        {"Free Memory: " + String(freeMemory()), false, false},
-        {"Range Config: Active", false, false},
-        {"Audio System: Active", false, false},  // NEW: Audio system info
-        {"Back", true, false}
-      };
-      drawScrollableMenu(items, 5, "System Info");  // Changed from 4 to 5
-      break;
-    }
-    
-    // Factory Reset Confirmation Screens
-    case MENU_FACTORY_RESET_CONFIRM: {
-      // Draw white background confirmation dialog
-      display.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
-      display.setTextColor(SSD1306_BLACK);
-      display.setTextSize(1);
-      
-      // Title
-      display.setCursor(15, 5);
-      display.println("Factory Reset");
-      
-      // Warning message
-      display.setCursor(5, 20);
-      display.println("Are you sure you want");
-      display.setCursor(5, 30);
-      display.println("to reset all settings");
-      display.setCursor(5, 40);
-      display.println("to factory defaults?");
-      
-      // Selection options
-      display.setCursor(20, 55);
-      if (menuSelection == 0) {
-        display.print("[No]");
-      } else {
-        display.print("No");
-      }
-      
-      display.print("    ");
-      
-      if (menuSelection == 1) {
-        display.print("[Yes]");
-      } else {
-        display.print("Yes");
-      }
-      
-      display.setTextColor(SSD1306_WHITE);
-      break;
-    }
-    
-    case MENU_FACTORY_RESET_FINAL: {
-      // Draw white background final confirmation
-      display.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
-      display.setTextColor(SSD1306_BLACK);
-      display.setTextSize(1);
-      
-      // Title with emphasis
-      display.setCursor(20, 5);
-      display.println("FINAL WARNING");
-      
-      // Strong warning message
-      display.setCursor(8, 20);
-      display.println("ARE YOU ABSOLUTELY");
-      display.setCursor(35, 30);
-      display.println("SURE?");
-      
-      // Selection options at bottom
-      display.setCursor(20, 57);
-      if (menuSelection == 0) {
-        display.print("[No]");
-      } else {
-        display.print("No");
-      }
-      
-      display.print("    ");
-      
-      if (menuSelection == 1) {
-        display.print("[YES]");
-      } else {
-        display.print("YES");
-      }
-      
-      display.setTextColor(SSD1306_WHITE);
-      break;
-    }
-    
-    case MENU_FACTORY_RESET_PROGRESS: {
-      drawFactoryResetScreen();
-      break;
-    }
+  const MenuNode& node = getMenuNode(currentMenu);
+  
+  if (node.draw) {
+    node.draw();
+  } else if (node.items) {
+    const char* header = node.headerStatus ? node.headerStatus(0) : node.header;
+    drawScrollableMenu(node.items, node.itemCount, header);
   }
 }
 
-void drawScrollableMenu(MenuItem* items, int itemCount, String header) {
+void drawScrollableMenu(const MenuItem* items, int itemCount, const char* header) {
   // Draw header
   display.setTextSize(1);
   display.setCursor(0, 0);
@@ -274,6 +114,9 @@ void drawScrollableMenu(MenuItem* items, int itemCount, String header) {
     // Draw menu item text
     display.setCursor(2, yPos + 2);
     display.print(items[itemIndex].title);
+    if (items[itemIndex].status) {
+      display.print(items[itemIndex].status(items[itemIndex].arg));
+    }
     
     // Draw submenu indicator
     if (items[itemIndex].hasSubmenu) {
@@ -332,4 +175,175 @@ void drawCancelConfirmation() {
   display.setTextColor(SSD1306_WHITE);
 }
 
-#endif
\ No newline at end of file
+// Factory Reset Confirmation Screens - the No/Yes items come from the node
+void drawFactoryResetConfirm() {
+  // Draw white background confirmation dialog
+  display.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
+  display.setTextColor(SSD1306_BLACK);
+  display.setTextSize(1);
+  
+  // Title
+  display.setCursor(15, 5);
+  display.println("Factory Reset");
+  
+  // Warning message
+  display.setCursor(5, 20);
+  display.println("Are you sure you want");
+  display.setCursor(5, 30);
+  display.println("to reset all settings");
+  display.setCursor(5, 40);
+  display.println("to factory defaults?");
+  
+  // Selection options
+  display.setCursor(20, 55);
+  if (menuSelection == 0) {
+    display.print("[No]");
+  } else {
+    display.print("No");
+  }
+  
+  display.print("    ");
+  
+  if (menuSelection == 1) {
+    display.print("[Yes]");
+  } else {
+    display.print("Yes");
+  }
+  
+  display.setTextColor(SSD1306_WHITE);
+}
+
+void drawFactoryResetFinal() {
+  // Draw white background final confirmation
+  display.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, SSD1306_WHITE);
+  display.setTextColor(SSD1306_BLACK);
+  display.setTextSize(1);
+  
+  // Title with emphasis
+  display.setCursor(20, 5);
+  display.println("FINAL WARNING");
+  
+  // Strong warning message
+  display.setCursor(8, 20);
+  display.println("ARE YOU ABSOLUTELY");
+  display.setCursor(35, 30);
+  display.println("SURE?");
+  
+  // Selection options at bottom
+  display.setCursor(20, 57);
+  if (menuSelection == 0) {
+    display.print("[No]");
+  } else {
+    display.print("No");
+  }
+  
+  display.print("    ");
+  
+  if (menuSelection == 1) {
+    display.print("[YES]");
+  } else {
+    display.print("YES");
+  }
+  
+  display.setTextColor(SSD1306_WHITE);
+}
+
+// Status callbacks
+const char* menuStatusCalibration(int axis) {
+  snprintf(menuStatusText, sizeof(menuStatusText), "%s %s", axisTable[axis].label, getCalibrationStatus(axis));
+  return menuStatusText;
+}
+
+const char* menuStatusRange(int field) {
+  switch (field) {
+    case MENU_RANGE_THROTTLE_MIN: snprintf(menuStatusText, sizeof(menuStatusText), "%dus", settings.throttleMinPWM); break;
+    case MENU_RANGE_THROTTLE_MAX: snprintf(menuStatusText, sizeof(menuStatusText), "%dus", settings.throttleMaxPWM); break;
+    case MENU_RANGE_STEER_MIN: snprintf(menuStatusText, sizeof(menuStatusText), "%d°", settings.steerMinDegree); break;
+    case MENU_RANGE_STEER_NEUTRAL: snprintf(menuStatusText, sizeof(menuStatusText), "%d°", settings.steerNeutralDegree); break;
+    case MENU_RANGE_STEER_MAX: snprintf(menuStatusText, sizeof(menuStatusText), "%d°", settings.steerMaxDegree); break;
+    default: return "";
+  }
+  return menuStatusText;
+}
+
+const char* menuStatusFlag(int flag) {
+  bool* value = getMenuFlag(flag);
+  return (value && *value) ? "ON" : "OFF";
+}
+
+// The setting behind an ON/OFF menu line (shared with toggleMenuFlag)
+bool* getMenuFlag(int flag) {
+  switch (flag) {
+    case MENU_FLAG_AUDIO: return &settings.audioEnabled;
+    case MENU_FLAG_SYSTEM_SOUNDS: return &settings.systemSounds;
+    case MENU_FLAG_NAVIGATION_SOUNDS: return &settings.navigationSounds;
+    case MENU_FLAG_ALERT_SOUNDS: return &settings.alertSounds;
+    case MENU_FLAG_MUSIC: return &settings.musicEnabled;
+    case MENU_FLAG_LED: return &settings.ledEnabled;
+    case MENU_FLAG_FAILSAFE: return &settings.failsafeEnabled;
+    default: return NULL;
+  }
+}
+
+const char* getMenuFlagName(int flag) {
+  switch (flag) {
+    case MENU_FLAG_AUDIO: return "Audio enabled";
+    case MENU_FLAG_SYSTEM_SOUNDS: return "System sounds";
+    case MENU_FLAG_NAVIGATION_SOUNDS: return "Navigation sounds";
+    case MENU_FLAG_ALERT_SOUNDS: return "Alert sounds";
+    case MENU_FLAG_MUSIC: return "Music enabled";
+    case MENU_FLAG_LED: return "LED Enable";
+    case MENU_FLAG_FAILSAFE: return "Failsafe";
+    default: return "?";
+  }
+}
+
+const char* menuStatusVolume(int arg) {
+  snprintf(menuStatusText, sizeof(menuStatusText), "%d%%", settings.audioVolume);
+  return menuStatusText;
+}
+
+const char* menuStatusFailsafe(int axis) {
+  snprintf(menuStatusText, sizeof(menuStatusText), "%d", axis == 0 ? settings.failsafeThrottle : settings.failsafeSteering);
+  return menuStatusText;
+}
+
+const char* menuStatusRateSwitch(int arg) {
+  return getRateSwitchName(curveData.rateSwitch);
+}
+
+const char* menuStatusMixer(int arg) {
+  return getMixerPresetName(mixerData.preset);
+}
+
+const char* menuStatusLogicSwitch(int index) {
+  snprintf(menuStatusText, sizeof(menuStatusText), "%s%s%s", getLogicSourceName(LS_SRC_LOGIC + index),
+           isLogicSwitchOn(index) ? "* " : "  ", getLogicSwitchSummary(index));
+  return menuStatusText;
+}
+
+// Fields of the channel being edited (curveEditChannel)
+const char* menuStatusCurve(int field) {
+  ChannelCurve& curve = curveData.channels[curveEditChannel];
+  switch (field) {
+    case MENU_CURVE_EXPO: snprintf(menuStatusText, sizeof(menuStatusText), "%d%%", curve.expo); break;
+    case MENU_CURVE_RATE_HIGH: snprintf(menuStatusText, sizeof(menuStatusText), "%d%%", curve.rateHigh); break;
+    case MENU_CURVE_RATE_LOW: snprintf(menuStatusText, sizeof(menuStatusText), "%d%%", curve.rateLow); break;
+    case MENU_CURVE_TYPE: return getCurveTypeName(curve.curveType);
+    case MENU_CURVE_SLEW: return getSlewRateName(curveEditChannel == CURVE_STEERING ? MIX_OUT_STEERING : MIX_OUT_THROTTLE);
+    default: return "";
+  }
+  return menuStatusText;
+}
+
+const char* menuStatusFreeMemory(int arg) {
+  snprintf(menuStatusText, sizeof(menuStatusText), "%d", freeMemory());
+  return menuStatusText;
+}
+
+// Header of the channel curve menu
+const char* menuStatusCurveChannel(int arg) {
+  return curveEditChannel == CURVE_STEERING ? "Steering Curve" : "Throttle Curve";
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 // Function to draw the system information page
 void drawSystemInfo() {
+  finishDisplayFlush();
   display.clearDisplay();
   
   // Header
@@ -44,6 +45,7 @@ void drawSystemInfo() {
   display.print("Range Config: Active");
   
   display.display();
+  invalidateDisplayShadow();
 }
 
 #endif
\ No newline at end of file
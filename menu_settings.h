@@ -10,11 +10,6 @@
 #include "display.h"
 #include "menu_data.h"
 
-// Constants
-#define NAV_DEBOUNCE 200
-#define RAPID_CHANGE_THRESHOLD 1500  // Hold for 1.5 seconds for rapid change
-#define RAPID_CHANGE_INTERVAL 100    // Change every 100ms when rapid
-
 // Settings variables
 bool settingActive = false;
 bool keyboardActive = false;
@@ -35,38 +30,48 @@ bool settingBeingCancelled = false;
 LEDColorMode currentLEDMode = LED_COLOR_ARMED;
 int ledColorComponent = 0; // 0=R, 1=G, 2=B
 
-// Rapid change variables
-unsigned long buttonPressStartTime = 0;
-bool rapidChangeActive = false;
-unsigned long lastRapidChange = 0;
-int lastNavDirection = 0;
+// Curve editor variables
+int curveEditChannel = CURVE_STEERING;
+int curvePointIndex = 0;
+
+// Deadzone editor variables
+int deadzoneEditAxis = DZ_STEERING;  // NUM_DEADZONE_AXES = hysteresis
+
+// Logic switch editor variables
+int logicEditSwitch = 0;
+int logicEditField = 0;  // 0 = function, 1 = source A, 2 = value or source B
 
 // External variables from menu.h
 extern MenuState currentMenu;
 extern int menuSelection;
 extern int menuOffset;
-extern int maxMenuItems;
-extern unsigned long lastNavigation;
 extern unsigned long menuTimer;
 
 // Forward declarations for external functions
-extern ButtonStates buttons;
-extern int getNavigationDirection();
+extern int getNavigationDirection(const InputEvent& event);
 
 // Function declarations
 void initMenuSettings();
-void updateMenuSettings();
-void handleSettingNavigation();
-void handleKeyboardNavigation();
-void startSetting(String settingType);
+void updateMenuSettings(const InputEvent& event);
+void handleSettingNavigation(const InputEvent& event);
+void handleKeyboardNavigation(const InputEvent& event);
+void startSetting(int editor);
 void completeSetting();
 void cancelSetting();
 void exitMenuSettings();
 void goBackSettings();
-void handleLEDSettingsSelection(int selection);
-void handleFailsafeSettingsSelection(int selection);
-void handleRangeSettingsSelection(int selection);
-void handleAudioSettingsSelection(int selection);  // NEW: Audio settings handler
+void toggleMenuFlag(int flag);
+void selectLEDColor(int mode);
+void selectCurveChannel(int channel);
+void cycleRateSwitch(int arg);
+void cycleMixerPreset(int arg);
+void selectLogicSwitch(int index);
+void cycleCurveType(int arg);
+void editCurvePoints(int arg);
+void cycleChannelSlew(int arg);
+void resetCurvesToDefaults();
+void adjustLogicSwitchField(int direction, bool fast);
+bool isCurveSettingMenu();
 void resetAllSettings();
 void resetRangeSettings();
 void resetAudioSettings();  // NEW: Reset audio settings
@@ -75,6 +80,9 @@ void drawSettingScreen();
 void drawFailsafeSettingScreen();
 void drawRangeSettingScreen();
 void drawAudioSettingScreen();  // NEW: Audio setting screen
+void drawCurveSettingScreen();
+void drawLogicSwitchSettingScreen();
+void drawCurveGraph(int x, int y, int size, bool lowRate);
 void drawKeyboardScreen();
 void drawSettingSaveScreen();
 bool isSettingActive();
@@ -107,8 +115,8 @@ void drawSettingSaveScreen() {
   display.setTextSize(1);
   
   // Center the text
-  String saveText = "Setting Being Saved";
-  int textWidth = saveText.length() * 6; // Approximate character width
+  const char* saveText = "Setting Being Saved";
+  int textWidth = strlen(saveText) * 6; // Approximate character width
   int textX = (SCREEN_WIDTH - textWidth) / 2;
   int textY = 20;
   
@@ -131,8 +139,9 @@ void drawSettingSaveScreen() {
   }
   
   // Show percentage
-  String percentText = String((int)(progress * 100)) + "%";
-  int percentWidth = percentText.length() * 6;
+  char percentText[8];
+  snprintf(percentText, sizeof(percentText), "%d%%", (int)(progress * 100));
+  int percentWidth = strlen(percentText) * 6;
   int percentX = (SCREEN_WIDTH - percentWidth) / 2;
   int percentY = 50;
   
@@ -147,13 +156,12 @@ void initMenuSettings() {
   // Initialize settings subsystem
   settingActive = false;
   keyboardActive = false;
-  rapidChangeActive = false;
   settingJustCompleted = false;
   settingCompletionTime = 0;
   settingBeingCancelled = false; // Initialize cancel flag
 }
 
-void updateMenuSettings() {
+void updateMenuSettings(const InputEvent& event) {
   // Check if we're in the lockout period after completing a setting
   if (settingJustCompleted) {
     if (millis() - settingCompletionTime > SETTING_LOCKOUT_PERIOD) {
@@ -166,67 +174,47 @@ void updateMenuSettings() {
   }
   
   if (keyboardActive) {
-    handleKeyboardNavigation();
+    handleKeyboardNavigation(event);
   } else {
-    handleSettingNavigation();
+    handleSettingNavigation(event);
   }
 }
 
-void handleSettingNavigation() {
-  static bool lastOkState = false;
-  bool currentOkState = buttons.btnOK;
-  
-  // Handle OK button with debounce to prevent double-entry
-  if (currentOkState && !lastOkState) {
-    // OK button just pressed
-    if (millis() - lastNavigation > NAV_DEBOUNCE) {
-      completeSetting();
-      lastNavigation = millis();
-      return; // Exit immediately to prevent further processing
-    }
+void handleSettingNavigation(const InputEvent& event) {
+  // OK completes the setting - the event is consumed, so it cannot also act on the parent menu
+  if (event.type == INPUT_EVENT_PRESS && event.input == BTN_OK) {
+    completeSetting();
+    return;
   }
-  lastOkState = currentOkState;
   
-  if (millis() - lastNavigation < NAV_DEBOUNCE && !rapidChangeActive) return;
+  int navDirection = getNavigationDirection(event);
   
-  int navDirection = getNavigationDirection();
+  // Auto-repeat accelerates on its own; held long enough, steps get larger too
+  bool rapidChangeActive = event.fast;
   
-  // Handle rapid change for continuous button press
   if (navDirection != 0) {
-    if (lastNavDirection == navDirection) {
-      // Same direction - check for rapid change
-      if (!rapidChangeActive && millis() - buttonPressStartTime > RAPID_CHANGE_THRESHOLD) {
-        rapidChangeActive = true;
-        Serial.println("Rapid change activated");
-      }
-    } else {
-      // Direction changed - reset rapid change
-      buttonPressStartTime = millis();
-      rapidChangeActive = false;
-      lastNavDirection = navDirection;
-    }
-  } else {
-    // No input - reset rapid change
-    rapidChangeActive = false;
-    lastNavDirection = 0;
-  }
-  
-  // Apply changes based on rapid mode
-  bool shouldChange = false;
-  if (!rapidChangeActive) {
-    shouldChange = (navDirection != 0);
-  } else {
-    shouldChange = (navDirection != 0) && (millis() - lastRapidChange > RAPID_CHANGE_INTERVAL);
-  }
-  
-  if (shouldChange) {
-    menuTimer = millis();
-    
     if (currentMenu == MENU_DEADZONE_SETTING) {
-      if (navDirection == 2 || navDirection == 1) { // Right or Down - increase
-        settings.joystickDeadzone = min(200, settings.joystickDeadzone + (rapidChangeActive ? 10 : 5));
-      } else if (navDirection == -2 || navDirection == -1) { // Left or Up - decrease
-        settings.joystickDeadzone = max(0, settings.joystickDeadzone - (rapidChangeActive ? 10 : 5));
+      if (navDirection == 1) { // Down - next axis
+        deadzoneEditAxis = (deadzoneEditAxis + 1) % (NUM_DEADZONE_AXES + 1);
+      } else if (navDirection == -1) { // Up - previous axis
+        deadzoneEditAxis = (deadzoneEditAxis + NUM_DEADZONE_AXES) % (NUM_DEADZONE_AXES + 1);
+      } else {
+        int step = (navDirection == 2 ? 1 : -1) * (rapidChangeActive ? 10 : 5);
+        if (deadzoneEditAxis == NUM_DEADZONE_AXES) {
+          deadzoneData.hysteresis = constrain(deadzoneData.hysteresis + step, 0, DEADZONE_HYSTERESIS_MAX);
+        } else {
+          deadzoneData.deadzone[deadzoneEditAxis] = constrain(deadzoneData.deadzone[deadzoneEditAxis] + step, 0, DEADZONE_MAX);
+        }
+        compileDeadzones();  // Live preview on the sticks
+      }
+    } else if (currentMenu == MENU_LOGIC_SWITCH_SETTING) {
+      if (navDirection == 1) { // Down - next field
+        logicEditField = (logicEditField + 1) % 3;
+      } else if (navDirection == -1) { // Up - previous field
+        logicEditField = (logicEditField + 2) % 3;
+      } else {
+        adjustLogicSwitchField(navDirection == 2 ? 1 : -1, rapidChangeActive);
+        compileLogicSwitches();  // Live state on the editor screen
       }
     } else if (currentMenu == MENU_BRIGHTNESS_SETTING) {
       if (navDirection == 2 || navDirection == 1) { // Right or Down - increase
@@ -301,6 +289,40 @@ void handleSettingNavigation() {
         settings.steerMaxDegree = max(settings.steerNeutralDegree + 5, settings.steerMaxDegree - (rapidChangeActive ? 10 : 5));
       }
     }
+    // Curve settings navigation - recompile immediately so the stick response can be felt
+    else if (currentMenu == MENU_CURVE_EXPO_SETTING) {
+      ChannelCurve& curve = curveData.channels[curveEditChannel];
+      if (navDirection == 2 || navDirection == 1) { // Right or Down - increase
+        curve.expo = min(100, curve.expo + (rapidChangeActive ? 10 : 5));
+      } else if (navDirection == -2 || navDirection == -1) { // Left or Up - decrease
+        curve.expo = max(-100, curve.expo - (rapidChangeActive ? 10 : 5));
+      }
+      compileCurves();
+    } else if (currentMenu == MENU_CURVE_RATE_HIGH_SETTING || currentMenu == MENU_CURVE_RATE_LOW_SETTING) {
+      ChannelCurve& curve = curveData.channels[curveEditChannel];
+      uint8_t& rate = (currentMenu == MENU_CURVE_RATE_HIGH_SETTING) ? curve.rateHigh : curve.rateLow;
+      if (navDirection == 2 || navDirection == 1) { // Right or Down - increase
+        rate = min(100, rate + (rapidChangeActive ? 10 : 5));
+      } else if (navDirection == -2 || navDirection == -1) { // Left or Up - decrease
+        rate = max(0, rate - (rapidChangeActive ? 10 : 5));
+      }
+      compileCurves();
+    } else if (currentMenu == MENU_CURVE_POINTS_SETTING) {
+      ChannelCurve& curve = curveData.channels[curveEditChannel];
+      int pointCount = getCurvePointCount(curveEditChannel);
+      if (navDirection == 2) { // Right - next point
+        curvePointIndex = (curvePointIndex + 1) % pointCount;
+      } else if (navDirection == -2) { // Left - previous point
+        curvePointIndex = (curvePointIndex + pointCount - 1) % pointCount;
+      } else if (navDirection == -1) { // Up - raise point
+        int16_t& point = curve.points[getCurvePointSlot(pointCount, curvePointIndex)];
+        point = min(1000, point + (rapidChangeActive ? 50 : 10));
+      } else if (navDirection == 1) { // Down - lower point
+        int16_t& point = curve.points[getCurvePointSlot(pointCount, curvePointIndex)];
+        point = max(-1000, point - (rapidChangeActive ? 50 : 10));
+      }
+      compileCurves();
+    }
     // NEW: Audio volume setting navigation
     else if (currentMenu == MENU_AUDIO_VOLUME_SETTING) {
       if (navDirection == 2 || navDirection == 1) { // Right or Down - increase
@@ -311,22 +333,12 @@ void handleSettingNavigation() {
         applyAudioSettings();  // Apply immediately to hear the volume change
       }
     }
-    
-    if (rapidChangeActive) {
-      lastRapidChange = millis();
-    } else {
-      lastNavigation = millis();
-    }
   }
 }
 
-void handleKeyboardNavigation() {
-  if (millis() - lastNavigation < NAV_DEBOUNCE) return;
-  
-  int navDirection = getNavigationDirection();
+void handleKeyboardNavigation(const InputEvent& event) {
+  int navDirection = getNavigationDirection(event);
   if (navDirection != 0) {
-    menuTimer = millis();
-    
     if (navDirection == 2) { // Right - next character
       keyboardCharPos = (keyboardCharPos + 1) % keyboardChars.length();
     } else if (navDirection == -2) { // Left - previous character
@@ -336,12 +348,13 @@ void handleKeyboardNavigation() {
     } else if (navDirection == -1) { // Up - previous row (skip 9 chars for new layout)
       keyboardCharPos = (keyboardCharPos + keyboardChars.length() - 9) % keyboardChars.length();
     }
-    
-    lastNavigation = millis();
+    return;
   }
   
+  if (event.type != INPUT_EVENT_PRESS) return;
+  
   // Check for OK to select character
-  if (buttons.btnOK && millis() - lastNavigation > NAV_DEBOUNCE) {
+  if (event.input == BTN_OK) {
     if (keyboardCursorPos < 5) { // Max 5 characters for radio address
       if (keyboardCursorPos >= keyboardInput.length()) {
         keyboardInput += keyboardChars[keyboardCharPos];
@@ -350,64 +363,48 @@ void handleKeyboardNavigation() {
       }
       keyboardCursorPos++;
     }
-    lastNavigation = millis();
   }
   
   // Check for backspace (left joystick button)
-  if (buttons.leftJoyBtn && millis() - lastNavigation > NAV_DEBOUNCE) {
+  if (event.input == BTN_LEFT_JOY) {
     if (keyboardInput.length() > 0 && keyboardCursorPos > 0) {
       keyboardInput.remove(keyboardCursorPos - 1, 1);
       keyboardCursorPos--;
     }
-    lastNavigation = millis();
   }
   
   // Check for SAVE (right joystick button - only in keyboard mode)
-  if (buttons.rightJoyBtn && millis() - lastNavigation > NAV_DEBOUNCE) {
+  if (event.input == BTN_RIGHT_JOY) {
     completeSetting();
-    lastNavigation = millis();
   }
 }
 
-void startSetting(String settingType) {
+// Open an editor node - the table (menu_tree.h) decides which one, this sets up its state
+void startSetting(int editor) {
   Serial.print("Starting setting: ");
-  Serial.println(settingType);
+  Serial.println(getMenuNode(editor).header);
   
   settingActive = true;
-  rapidChangeActive = false;
+  currentMenu = (MenuState)editor;
   
-  if (settingType == "DEADZONE") {
-    currentMenu = MENU_DEADZONE_SETTING;
-  } else if (settingType == "BRIGHTNESS") {
-    currentMenu = MENU_BRIGHTNESS_SETTING;
-  } else if (settingType == "RADIO_ADDRESS") {
-    currentMenu = MENU_RADIO_ADDRESS;
-    keyboardActive = true;
-    keyboardCursorPos = 0;
-    keyboardCharPos = 0;
-    keyboardInput = String(settings.radioAddress);
-  } else if (settingType == "CHANNEL") {
-    currentMenu = MENU_CHANNEL_SETTINGS;
-  } else if (settingType == "FAILSAFE_THROTTLE") {
-    currentMenu = MENU_FAILSAFE_THROTTLE_SETTING;
-  } else if (settingType == "FAILSAFE_STEERING") {
-    currentMenu = MENU_FAILSAFE_STEERING_SETTING;
-  }
-  // Range settings
-  else if (settingType == "THROTTLE_MIN") {
-    currentMenu = MENU_THROTTLE_MIN_SETTING;
-  } else if (settingType == "THROTTLE_MAX") {
-    currentMenu = MENU_THROTTLE_MAX_SETTING;
-  } else if (settingType == "STEER_MIN") {
-    currentMenu = MENU_STEER_MIN_SETTING;
-  } else if (settingType == "STEER_NEUTRAL") {
-    currentMenu = MENU_STEER_NEUTRAL_SETTING;
-  } else if (settingType == "STEER_MAX") {
-    currentMenu = MENU_STEER_MAX_SETTING;
-  }
-  // NEW: Audio settings
-  else if (settingType == "AUDIO_VOLUME") {
-    currentMenu = MENU_AUDIO_VOLUME_SETTING;
+  switch (editor) {
+    case MENU_DEADZONE_SETTING:
+      deadzoneEditAxis = DZ_STEERING;
+      break;
+    case MENU_LOGIC_SWITCH_SETTING:  // Switch selected by logicEditSwitch
+      logicEditField = 0;
+      break;
+    case MENU_RADIO_ADDRESS:
+      keyboardActive = true;
+      keyboardCursorPos = 0;
+      keyboardCharPos = 0;
+      keyboardInput = String(settings.radioAddress);
+      break;
+    case MENU_CURVE_POINTS_SETTING:  // Channel selected by curveEditChannel
+      curvePointIndex = 0;
+      break;
+    default:
+      break;
   }
 }
 
@@ -424,47 +421,37 @@ void completeSetting() {
     // Copy keyboard input to settings
     keyboardInput.toCharArray(settings.radioAddress, 6);
     keyboardActive = false;
+    selectTrimModel(settings.radioAddress);  // Trims follow the model
   }
   
-  saveSettings();  // ONLY save when completing via OK button
+  // ONLY save when completing via OK button
+  if (isCurveSettingMenu()) {
+    saveCurves();
+    compileCurves();
+    Serial.println("Curves compiled into lookup tables");
+  } else if (currentMenu == MENU_DEADZONE_SETTING) {
+    saveDeadzones();
+    compileDeadzones();
+  } else if (currentMenu == MENU_LOGIC_SWITCH_SETTING) {
+    saveLogicSwitches();
+    Serial.print("Logic switches compiled: ");
+    Serial.print(compileLogicSwitches());
+    Serial.println(" bytes");
+  } else {
+    saveSettings();
+  }
   extern void playSaveSound();
   playSaveSound();
   settingActive = false;
-  rapidChangeActive = false;
-  
-  // Return to appropriate parent menu
-  if (currentMenu == MENU_FAILSAFE_THROTTLE_SETTING || currentMenu == MENU_FAILSAFE_STEERING_SETTING) {
-    currentMenu = MENU_FAILSAFE_SETTINGS;
-    maxMenuItems = 4;
-  } else if (currentMenu == MENU_THROTTLE_MIN_SETTING || currentMenu == MENU_THROTTLE_MAX_SETTING || 
-             currentMenu == MENU_STEER_MIN_SETTING || currentMenu == MENU_STEER_NEUTRAL_SETTING || 
-             currentMenu == MENU_STEER_MAX_SETTING) {
-    // Return to Range Settings menu
-    currentMenu = MENU_RANGE_SETTINGS;
-    maxMenuItems = 7;
-  } else if (currentMenu == MENU_AUDIO_VOLUME_SETTING) {
-    // NEW: Return to Audio Settings menu
-    currentMenu = MENU_AUDIO_SETTINGS;
-    maxMenuItems = 9;
-  } else {
-    currentMenu = MENU_SETTINGS;
-    maxMenuItems = 8;
-  }
   
-  menuSelection = 0;
-  menuOffset = 0;
+  // Return to the editor's parent menu
+  setCurrentMenu(getMenuNode(currentMenu).parent);
   
   // CRITICAL FIX: Enable setting completion lockout
   settingJustCompleted = true;
   settingCompletionTime = millis();
   
-  // Reset all timing and state variables
-  lastNavigation = millis();
   menuTimer = millis();
-  rapidChangeActive = false;
-  buttonPressStartTime = 0;
-  lastRapidChange = 0;
-  lastNavDirection = 0;
   
   Serial.println("Setting lockout enabled - preventing menu actions for 1 second");
 }
@@ -477,41 +464,27 @@ void cancelSetting() {
   applyLEDSettings();     // Restore LED state
   applyDisplayBrightness(); // Restore display brightness
   applyAudioSettings();   // NEW: Restore audio settings
+  if (isCurveSettingMenu()) {
+    loadCurves();         // Restore curves edited live
+    compileCurves();
+  }
+  if (currentMenu == MENU_DEADZONE_SETTING) {
+    loadDeadzones(settings.joystickDeadzone);  // Restore deadzones edited live
+    compileDeadzones();
+  }
+  if (currentMenu == MENU_LOGIC_SWITCH_SETTING) {
+    loadLogicSwitches();  // Restore the switch edited live
+    compileLogicSwitches();
+  }
   
   settingActive = false;
   keyboardActive = false;
-  rapidChangeActive = false;
   settingBeingCancelled = false; // Reset cancel flag
   
-  // Return to appropriate parent menu
-  if (currentMenu == MENU_FAILSAFE_THROTTLE_SETTING || currentMenu == MENU_FAILSAFE_STEERING_SETTING) {
-    currentMenu = MENU_FAILSAFE_SETTINGS;
-    maxMenuItems = 4;
-  } else if (currentMenu == MENU_THROTTLE_MIN_SETTING || currentMenu == MENU_THROTTLE_MAX_SETTING || 
-             currentMenu == MENU_STEER_MIN_SETTING || currentMenu == MENU_STEER_NEUTRAL_SETTING || 
-             currentMenu == MENU_STEER_MAX_SETTING) {
-    // Return to Range Settings menu
-    currentMenu = MENU_RANGE_SETTINGS;
-    maxMenuItems = 7;
-  } else if (currentMenu == MENU_AUDIO_VOLUME_SETTING) {
-    // NEW: Return to Audio Settings menu
-    currentMenu = MENU_AUDIO_SETTINGS;
-    maxMenuItems = 9;
-  } else {
-    currentMenu = MENU_SETTINGS;
-    maxMenuItems = 8;
-  }
-  
-  menuSelection = 0;
-  menuOffset = 0;
+  // Return to the editor's parent menu
+  setCurrentMenu(getMenuNode(currentMenu).parent);
   
-  // Reset all timing and state variables
-  lastNavigation = millis();
   menuTimer = millis();
-  rapidChangeActive = false;
-  buttonPressStartTime = 0;
-  lastRapidChange = 0;
-  lastNavDirection = 0;
 }
 
 void exitMenuSettings() {
@@ -530,103 +503,125 @@ void goBackSettings() {
   cancelSetting();
 }
 
-void handleLEDSettingsSelection(int selection) {
-  switch (selection) {
-    case 0: // Toggle LED enabled
-      settings.ledEnabled = !settings.ledEnabled;
-      applyLEDSettings();  // Apply immediately
-      saveSettings();      // Save to EEPROM
-      Serial.print("LED Enable toggled to: ");
-      Serial.println(settings.ledEnabled ? "ON" : "OFF");
-      break;
-    case 1: currentLEDMode = LED_COLOR_ARMED; currentMenu = MENU_LED_COLOR_SETTING; settingActive = true; break;
-    case 2: currentLEDMode = LED_COLOR_DISARMED; currentMenu = MENU_LED_COLOR_SETTING; settingActive = true; break;
-    case 3: currentLEDMode = LED_COLOR_TRANSMITTING; currentMenu = MENU_LED_COLOR_SETTING; settingActive = true; break;
-    case 4: currentLEDMode = LED_COLOR_ERROR; currentMenu = MENU_LED_COLOR_SETTING; settingActive = true; break;
-    case 5: currentLEDMode = LED_COLOR_MENU; currentMenu = MENU_LED_COLOR_SETTING; settingActive = true; break;
+// Flip an ON/OFF setting (MenuFlag), apply and save it
+void toggleMenuFlag(int flag) {
+  bool* value = getMenuFlag(flag);
+  if (value == NULL) return;
+  
+  *value = !*value;
+  if (flag == MENU_FLAG_LED) {
+    applyLEDSettings();
+  } else if (flag != MENU_FLAG_FAILSAFE) {
+    applyAudioSettings();
   }
+  saveSettings();
+  
+  Serial.print(getMenuFlagName(flag));
+  Serial.print(" toggled to: ");
+  Serial.println(*value ? "ON" : "OFF");
 }
 
-void handleFailsafeSettingsSelection(int selection) {
-  switch (selection) {
-    case 0: // Toggle failsafe enabled
-      settings.failsafeEnabled = !settings.failsafeEnabled;
-      saveSettings();
-      break;
-    case 1: startSetting("FAILSAFE_THROTTLE"); return;
-    case 2: startSetting("FAILSAFE_STEERING"); return;
-  }
+// Runs before the LED colour editor opens
+void selectLEDColor(int mode) {
+  currentLEDMode = (LEDColorMode)mode;
 }
 
-void handleRangeSettingsSelection(int selection) {
-  switch (selection) {
-    case 0: startSetting("THROTTLE_MIN"); return;
-    case 1: startSetting("THROTTLE_MAX"); return;
-    case 2: startSetting("STEER_MIN"); return;
-    case 3: startSetting("STEER_NEUTRAL"); return;
-    case 4: startSetting("STEER_MAX"); return;
-    case 5: resetRangeSettings(); break;  // Reset to defaults
-  }
+// Runs before the channel curve menu opens
+void selectCurveChannel(int channel) {
+  curveEditChannel = channel;
 }
 
-// NEW: Audio settings selection handler
-void handleAudioSettingsSelection(int selection) {
-  extern void playTestSound();
+void cycleRateSwitch(int arg) {
+  curveData.rateSwitch = (curveData.rateSwitch + 1) % NUM_RATE_SWITCHES;
+  saveCurves();
+  Serial.print("Rate switch set to: ");
+  Serial.println(getRateSwitchName(curveData.rateSwitch));
+}
+
+void cycleMixerPreset(int arg) {
+  applyMixerPreset((mixerData.preset + 1) % NUM_MIX_PRESETS);
+  saveMixer();
+}
+
+// Runs before the logic switch editor opens
+void selectLogicSwitch(int index) {
+  logicEditSwitch = index;
+}
+
+// Left/Right on the selected field of the edited switch
+void adjustLogicSwitchField(int direction, bool fast) {
+  LogicSwitchDef& def = logicData.switches[logicEditSwitch];
   
-  switch (selection) {
-    case 0: // Toggle audio enabled
-      settings.audioEnabled = !settings.audioEnabled;
-      applyAudioSettings();
-      saveSettings();
-      Serial.print("Audio enabled toggled to: ");
-      Serial.println(settings.audioEnabled ? "ON" : "OFF");
-      break;
-    case 1: // Volume setting
-      startSetting("AUDIO_VOLUME");
-      return;
-    case 2: // Toggle system sounds
-      settings.systemSounds = !settings.systemSounds;
-      applyAudioSettings();
-      saveSettings();
-      Serial.print("System sounds toggled to: ");
-      Serial.println(settings.systemSounds ? "ON" : "OFF");
-      break;
-    case 3: // Toggle navigation sounds
-      settings.navigationSounds = !settings.navigationSounds;
-      applyAudioSettings();
-      saveSettings();
-      Serial.print("Navigation sounds toggled to: ");
-      Serial.println(settings.navigationSounds ? "ON" : "OFF");
-      break;
-    case 4: // Toggle alert sounds
-      settings.alertSounds = !settings.alertSounds;
-      applyAudioSettings();
-      saveSettings();
-      Serial.print("Alert sounds toggled to: ");
-      Serial.println(settings.alertSounds ? "ON" : "OFF");
-      break;
-    case 5: // Toggle music enabled
-      settings.musicEnabled = !settings.musicEnabled;
-      applyAudioSettings();
-      saveSettings();
-      Serial.print("Music enabled toggled to: ");
-      Serial.println(settings.musicEnabled ? "ON" : "OFF");
-      break;
-    case 6: // Test sound
-      playTestSound();
-      Serial.println("Playing test sound");
-      break;
-    case 7: // Reset audio settings
-      resetAudioSettings();
-      break;
+  if (logicEditField == 0) {
+    def.function = (def.function + NUM_LOGIC_FUNCTIONS + direction) % NUM_LOGIC_FUNCTIONS;
+  } else if (logicEditField == 1) {
+    def.sourceA = (def.sourceA + NUM_LOGIC_SOURCES + direction) % NUM_LOGIC_SOURCES;
+  } else if (isLogicCompareFunction(def.function)) {
+    def.value = constrain(def.value + direction * (fast ? 5 : 1) * LOGIC_VALUE_STEP, -1000, 1000);
+  } else {
+    def.sourceB = (def.sourceB + NUM_LOGIC_SOURCES + direction) % NUM_LOGIC_SOURCES;
+  }
+}
+
+void cycleCurveType(int arg) {
+  ChannelCurve& curve = curveData.channels[curveEditChannel];
+  curve.curveType = (curve.curveType + 1) % 3;
+  saveCurves();
+  compileCurves();
+  Serial.print("Curve type set to: ");
+  Serial.println(getCurveTypeName(curve.curveType));
+}
+
+// Edit points - only meaningful for point curves
+void editCurvePoints(int arg) {
+  if (curveData.channels[curveEditChannel].curveType == CURVE_TYPE_EXPO) {
+    extern void playErrorSound();
+    playErrorSound();
+    Serial.println("Select a 5PT or 9PT curve before editing points");
+    return;
   }
+  startSetting(MENU_CURVE_POINTS_SETTING);
+}
+
+// Cycle the slew rate of this channel's output
+void cycleChannelSlew(int arg) {
+  cycleSlewRate(curveEditChannel == CURVE_STEERING ? MIX_OUT_STEERING : MIX_OUT_THROTTLE);
+  saveSlew();
+}
+
+void resetCurvesToDefaults() {
+  resetCurves();
+  saveCurves();
+  compileCurves();
+  Serial.println("Curves reset to defaults");
+}
+
+bool isCurveSettingMenu() {
+  return currentMenu == MENU_CURVE_EXPO_SETTING || currentMenu == MENU_CURVE_RATE_HIGH_SETTING ||
+         currentMenu == MENU_CURVE_RATE_LOW_SETTING || currentMenu == MENU_CURVE_POINTS_SETTING;
 }
 
 void resetAllSettings() {
   resetSettings();
   resetCalibration();
+  resetCurves();
+  resetMixer();
+  resetDeadzones(settings.joystickDeadzone);
+  compileDeadzones();
+  resetTrims();
+  selectTrimModel(settings.radioAddress);
+  resetSlew();
+  resetLogicSwitches();
+  compileLogicSwitches();
   saveSettings();
   saveCalibration();
+  saveCurves();
+  compileCurves();
+  saveMixer();
+  saveDeadzones();
+  saveTrimsNow();
+  saveSlew();
+  saveLogicSwitches();
   applyLEDSettings();
   applyDisplayBrightness();
   applyAudioSettings();  // NEW: Apply audio settings
@@ -682,6 +677,10 @@ void drawMenuSettings() {
   } else if (currentMenu == MENU_AUDIO_VOLUME_SETTING) {
     // NEW: Draw audio setting screen
     drawAudioSettingScreen();
+  } else if (isCurveSettingMenu()) {
+    drawCurveSettingScreen();
+  } else if (currentMenu == MENU_LOGIC_SWITCH_SETTING) {
+    drawLogicSwitchSettingScreen();
   } else {
     drawSettingScreen();
   }
@@ -694,17 +693,27 @@ void drawSettingScreen() {
   if (currentMenu == MENU_DEADZONE_SETTING) {
     display.println("Joystick Deadzone");
     display.setCursor(0, 16);
-    display.print("Value: ");
-    display.println(settings.joystickDeadzone);
+    display.print(getDeadzoneAxisName(deadzoneEditAxis));
+    display.print(": ");
+    
+    int value, maxValue;
+    if (deadzoneEditAxis == NUM_DEADZONE_AXES) {
+      value = deadzoneData.hysteresis;
+      maxValue = DEADZONE_HYSTERESIS_MAX;
+    } else {
+      value = deadzoneData.deadzone[deadzoneEditAxis];
+      maxValue = DEADZONE_MAX;
+    }
+    display.println(value);
     
     // Draw bar - positioned higher to fit on screen
-    int barWidth = map(settings.joystickDeadzone, 0, 200, 0, 100);
+    int barWidth = map(value, 0, maxValue, 0, 100);
     display.drawRect(10, 28, 102, 8, SSD1306_WHITE);
     display.fillRect(11, 29, barWidth, 6, SSD1306_WHITE);
     
     // Instructions positioned to fit on screen (y=40 and y=52)
     display.setCursor(0, 40);
-    display.println("Arrows: Adjust");
+    display.println("U/D: Axis L/R: Adjust");
     display.setCursor(0, 52);
     display.print("OK: Save");
     
@@ -740,7 +749,7 @@ void drawSettingScreen() {
     
     // Show RGB components - positioned at y=30
     display.setCursor(0, 30);
-    String components[] = {"R", "G", "B"};
+    const char* components[] = {"R", "G", "B"};
     bool* colorArray = getCurrentLEDColorArray();
     
     for (int i = 0; i < 3; i++) {
@@ -816,6 +825,127 @@ void drawAudioSettingScreen() {
   }
 }
 
+// Draw logic switch editor - function, sources and the switch's live state
+void drawLogicSwitchSettingScreen() {
+  const LogicSwitchDef& def = logicData.switches[logicEditSwitch];
+  
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print("Logic Switch ");
+  display.print(getLogicSourceName(LS_SRC_LOGIC + logicEditSwitch));
+  display.setCursor(92, 0);
+  display.print(isLogicSwitchOn(logicEditSwitch) ? "[ON]" : "[off]");
+  
+  display.setCursor(0, 16);
+  display.print(logicEditField == 0 ? "> " : "  ");
+  display.print("Func: ");
+  display.print(getLogicFunctionName(def.function));
+  
+  display.setCursor(0, 26);
+  display.print(logicEditField == 1 ? "> " : "  ");
+  display.print("A: ");
+  display.print(getLogicSourceName(def.sourceA));
+  display.print(" (");
+  display.print(logicSources[def.sourceA]);
+  display.print(")");
+  
+  display.setCursor(0, 36);
+  display.print(logicEditField == 2 ? "> " : "  ");
+  if (isLogicCompareFunction(def.function)) {
+    display.print("X: ");
+    display.print(def.value);
+  } else {
+    display.print("B: ");
+    display.print(getLogicSourceName(def.sourceB));
+  }
+  
+  display.setCursor(0, 52);
+  display.print("U/D:Field L/R:Set OK");
+}
+
+// Draw curve setting screen - value on the left, live curve preview on the right
+void drawCurveSettingScreen() {
+  ChannelCurve& curve = curveData.channels[curveEditChannel];
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print(curveEditChannel == CURVE_STEERING ? "Steering " : "Throttle ");
+  
+  if (currentMenu == MENU_CURVE_EXPO_SETTING) {
+    display.println("Expo");
+    display.setCursor(0, 16);
+    display.print("Expo: ");
+    display.print(curve.expo);
+    display.println("%");
+    display.setCursor(0, 28);
+    display.println("+ Soft ctr");
+    display.setCursor(0, 38);
+    display.println("- Sharp ctr");
+  } else if (currentMenu == MENU_CURVE_RATE_HIGH_SETTING || currentMenu == MENU_CURVE_RATE_LOW_SETTING) {
+    bool high = (currentMenu == MENU_CURVE_RATE_HIGH_SETTING);
+    display.println(high ? "High Rate" : "Low Rate");
+    display.setCursor(0, 16);
+    display.print("Rate: ");
+    display.print(high ? curve.rateHigh : curve.rateLow);
+    display.println("%");
+    display.setCursor(0, 28);
+    display.print("Sw: ");
+    display.println(getRateSwitchName(curveData.rateSwitch));
+  } else if (currentMenu == MENU_CURVE_POINTS_SETTING) {
+    display.println(getCurveTypeName(curve.curveType));
+    display.setCursor(0, 16);
+    display.print("Pt ");
+    display.print(curvePointIndex + 1);
+    display.print("/");
+    display.println(getCurvePointCount(curveEditChannel));
+    display.setCursor(0, 28);
+    display.print("Y: ");
+    display.println(curve.points[getCurvePointSlot(getCurvePointCount(curveEditChannel), curvePointIndex)]);
+    display.setCursor(0, 38);
+    display.println("L/R: Point");
+    display.setCursor(0, 46);
+    display.println("U/D: Value");
+  }
+  
+  display.setCursor(0, 56);
+  display.print("OK: Save");
+  
+  drawCurveGraph(80, 16, 47, currentMenu == MENU_CURVE_RATE_LOW_SETTING);
+}
+
+// Plot the compiled curve in a square box, with point markers in the point editor
+void drawCurveGraph(int x, int y, int size, bool lowRate) {
+  display.drawRect(x, y, size + 1, size + 1, SSD1306_WHITE);
+  
+  int mid = size / 2;
+  display.drawLine(x + mid, y, x + mid, y + size, SSD1306_WHITE);
+  display.drawLine(x, y + mid, x + size, y + mid, SSD1306_WHITE);
+  
+  int lastPy = 0;
+  for (int px = 0; px <= size; px++) {
+    int in = -1000 + (2000 * px) / size;
+    int out = applyChannelCurve(curveEditChannel, in, lowRate);
+    int py = mid - (out * mid) / 1000;
+    if (px > 0) {
+      display.drawLine(x + px - 1, y + lastPy, x + px, y + py, SSD1306_WHITE);
+    }
+    lastPy = py;
+  }
+  
+  if (currentMenu == MENU_CURVE_POINTS_SETTING) {
+    ChannelCurve& curve = curveData.channels[curveEditChannel];
+    int pointCount = getCurvePointCount(curveEditChannel);
+    for (int i = 0; i < pointCount; i++) {
+      int px = x + (i * size) / (pointCount - 1);
+      int py = y + mid - (curve.points[getCurvePointSlot(pointCount, i)] * mid) / 1000;
+      if (i == curvePointIndex) {
+        display.fillRect(px - 2, py - 2, 5, 5, SSD1306_WHITE);
+      } else {
+        display.drawRect(px - 1, py - 1, 3, 3, SSD1306_WHITE);
+      }
+    }
+  }
+}
+
 // Draw range setting screen
 void drawRangeSettingScreen() {
   display.setTextSize(1);
@@ -0,0 +1,326 @@
+/*
+  menu_tree.h - Declarative Menu Tree
+  RC Transmitter for Teensy 4.0
+
+  The whole menu structure lives here: one constexpr item table per list
+  menu and one node per MenuState in menuNodes[], indexed by the state.
+  A node names its parent (where Back goes), its items, its header and
+  optional draw/enter/leave hooks; an item names its action (open a
+  submenu, open an editor, call a handler, back, exit) and target. Item
+  counts, navigation and drawing are all derived from these tables, so
+  adding a menu line is a one-line table change and every lookup is a
+  direct array index.
+*/
+
+#ifndef MENU_TREE_H
+#define MENU_TREE_H
+
+#include "config.h"
+#include "menu_data.h"
+
+// External variables from menu.h
+extern MenuState currentMenu;
+extern int menuSelection;
+extern int menuOffset;
+
+// Forward declarations for external functions
+extern void goBack();
+extern void exitMenu();
+extern void startRadioTest();
+extern void resetRadioTest();
+extern void playTestSound();
+
+// Commands without their own handler (runMenuCommand)
+enum MenuCommand {
+  MENU_CMD_SWEEP_CALIBRATION = 0,
+  MENU_CMD_RESET_SETTINGS,
+  MENU_CMD_RESET_RANGE,
+  MENU_CMD_RESET_AUDIO,
+  MENU_CMD_RESET_CURVES,
+  MENU_CMD_TEST_SOUND
+};
+
+// Function declarations
+void runMenuCommand(int command);
+void runMenuItem(const MenuItem& item);
+void openMenuNode(int state);
+
+// Item rows - {title, status, handler, arg, action, target, enabled, hasSubmenu}
+#define MENU_ITEM_SUBMENU(title, target)            {title, NULL, NULL, 0, MENU_ACTION_SUBMENU, target, true, true}
+#define MENU_ITEM_SCREEN(title, target)             {title, NULL, NULL, 0, MENU_ACTION_SUBMENU, target, true, false}
+#define MENU_ITEM_EDIT(title, status, arg, target)  {title, status, NULL, arg, MENU_ACTION_EDIT, target, true, false}
+#define MENU_ITEM_CALL(title, status, handler, arg) {title, status, handler, arg, MENU_ACTION_CALL, 0, true, false}
+#define MENU_ITEM_INFO(title, status)               {title, status, NULL, 0, MENU_ACTION_NONE, 0, false, false}
+#define MENU_ITEM_BACK(title)                       {title, NULL, NULL, 0, MENU_ACTION_BACK, 0, true, false}
+#define MENU_ITEM_EXIT(title)                       {title, NULL, NULL, 0, MENU_ACTION_EXIT, 0, true, false}
+
+constexpr MenuItem mainMenuItems[] PROGMEM = {
+  MENU_ITEM_SUBMENU("Calibration", MENU_CALIBRATION),
+  MENU_ITEM_SUBMENU("Settings", MENU_SETTINGS),
+  MENU_ITEM_SUBMENU("Range Settings", MENU_RANGE_SETTINGS),
+  MENU_ITEM_SUBMENU("Curves & Rates", MENU_CURVES),
+  MENU_ITEM_SUBMENU("Audio Settings", MENU_AUDIO_SETTINGS),
+  MENU_ITEM_SUBMENU("System Info", MENU_INFO),
+  MENU_ITEM_SCREEN("Radio Test", MENU_RADIO_TEST),
+  MENU_ITEM_SCREEN("Display Test", MENU_DISPLAY_TEST),
+  MENU_ITEM_SCREEN("Input Test", MENU_BUTTON_TEST),
+  MENU_ITEM_SUBMENU("Factory Reset", MENU_FACTORY_RESET_CONFIRM),
+  MENU_ITEM_EXIT("Exit")
+};
+
+constexpr MenuItem calibrationMenuItems[] PROGMEM = {
+  MENU_ITEM_SUBMENU("Joystick Cal", MENU_JOYSTICK_CAL),
+  MENU_ITEM_SUBMENU("Potentiometer Cal", MENU_POTENTIOMETER_CAL),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem joystickCalMenuItems[] PROGMEM = {
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_RIGHT_X),
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_RIGHT_Y),
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_LEFT_X),
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_LEFT_Y),
+  MENU_ITEM_CALL("Sweep All Sticks", NULL, runMenuCommand, MENU_CMD_SWEEP_CALIBRATION),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem potentiometerCalMenuItems[] PROGMEM = {
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_LEFT_POT),
+  MENU_ITEM_CALL("", menuStatusCalibration, startAxisCalibration, AXIS_RIGHT_POT),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem settingsMenuItems[] PROGMEM = {
+  MENU_ITEM_EDIT("Joystick Deadzone", NULL, 0, MENU_DEADZONE_SETTING),
+  MENU_ITEM_EDIT("Display Brightness", NULL, 0, MENU_BRIGHTNESS_SETTING),
+  MENU_ITEM_SUBMENU("LED Settings", MENU_LED_SETTINGS),
+  MENU_ITEM_EDIT("Radio Address", NULL, 0, MENU_RADIO_ADDRESS),
+  MENU_ITEM_EDIT("Radio Channel", NULL, 0, MENU_CHANNEL_SETTINGS),
+  MENU_ITEM_SUBMENU("Failsafe Settings", MENU_FAILSAFE_SETTINGS),
+  MENU_ITEM_CALL("Reset to Defaults", NULL, runMenuCommand, MENU_CMD_RESET_SETTINGS),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem rangeMenuItems[] PROGMEM = {
+  MENU_ITEM_EDIT("Throttle Min: ", menuStatusRange, MENU_RANGE_THROTTLE_MIN, MENU_THROTTLE_MIN_SETTING),
+  MENU_ITEM_EDIT("Throttle Max: ", menuStatusRange, MENU_RANGE_THROTTLE_MAX, MENU_THROTTLE_MAX_SETTING),
+  MENU_ITEM_EDIT("Steer Min: ", menuStatusRange, MENU_RANGE_STEER_MIN, MENU_STEER_MIN_SETTING),
+  MENU_ITEM_EDIT("Steer Neutral: ", menuStatusRange, MENU_RANGE_STEER_NEUTRAL, MENU_STEER_NEUTRAL_SETTING),
+  MENU_ITEM_EDIT("Steer Max: ", menuStatusRange, MENU_RANGE_STEER_MAX, MENU_STEER_MAX_SETTING),
+  MENU_ITEM_CALL("Reset to Defaults", NULL, runMenuCommand, MENU_CMD_RESET_RANGE),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem curvesMenuItems[] PROGMEM = {
+  {"Steering Curve", NULL, selectCurveChannel, CURVE_STEERING, MENU_ACTION_SUBMENU, MENU_CURVE_CHANNEL, true, true},
+  {"Throttle Curve", NULL, selectCurveChannel, CURVE_THROTTLE, MENU_ACTION_SUBMENU, MENU_CURVE_CHANNEL, true, true},
+  MENU_ITEM_CALL("Rate Switch: ", menuStatusRateSwitch, cycleRateSwitch, 0),
+  MENU_ITEM_CALL("Mixer: ", menuStatusMixer, cycleMixerPreset, 0),
+  MENU_ITEM_SUBMENU("Logic Switches", MENU_LOGIC_SWITCHES),
+  MENU_ITEM_CALL("Reset Curves", NULL, runMenuCommand, MENU_CMD_RESET_CURVES),
+  MENU_ITEM_BACK("Back")
+};
+
+#define LOGIC_SWITCH_ITEM(index) \
+  {"", menuStatusLogicSwitch, selectLogicSwitch, index, MENU_ACTION_EDIT, MENU_LOGIC_SWITCH_SETTING, true, false}
+
+constexpr MenuItem logicSwitchesMenuItems[] PROGMEM = {
+  LOGIC_SWITCH_ITEM(0),
+  LOGIC_SWITCH_ITEM(1),
+  LOGIC_SWITCH_ITEM(2),
+  LOGIC_SWITCH_ITEM(3),
+  LOGIC_SWITCH_ITEM(4),
+  LOGIC_SWITCH_ITEM(5),
+  MENU_ITEM_BACK("Back")
+};
+static_assert(MENU_ITEM_COUNT(logicSwitchesMenuItems) == NUM_LOGIC_SWITCHES + 1, "One line per logic switch");
+
+constexpr MenuItem curveChannelMenuItems[] PROGMEM = {
+  MENU_ITEM_EDIT("Expo: ", menuStatusCurve, MENU_CURVE_EXPO, MENU_CURVE_EXPO_SETTING),
+  MENU_ITEM_EDIT("High Rate: ", menuStatusCurve, MENU_CURVE_RATE_HIGH, MENU_CURVE_RATE_HIGH_SETTING),
+  MENU_ITEM_EDIT("Low Rate: ", menuStatusCurve, MENU_CURVE_RATE_LOW, MENU_CURVE_RATE_LOW_SETTING),
+  MENU_ITEM_CALL("Curve: ", menuStatusCurve, cycleCurveType, MENU_CURVE_TYPE),
+  MENU_ITEM_CALL("Edit Points", NULL, editCurvePoints, 0),
+  MENU_ITEM_CALL("Slew: ", menuStatusCurve, cycleChannelSlew, MENU_CURVE_SLEW),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem audioMenuItems[] PROGMEM = {
+  MENU_ITEM_CALL("Audio Enable: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_AUDIO),
+  MENU_ITEM_EDIT("Volume: ", menuStatusVolume, 0, MENU_AUDIO_VOLUME_SETTING),
+  MENU_ITEM_CALL("System Sounds: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_SYSTEM_SOUNDS),
+  MENU_ITEM_CALL("Navigation: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_NAVIGATION_SOUNDS),
+  MENU_ITEM_CALL("Alert Sounds: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_ALERT_SOUNDS),
+  MENU_ITEM_CALL("Music Enable: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_MUSIC),
+  MENU_ITEM_CALL("Test Sound", NULL, runMenuCommand, MENU_CMD_TEST_SOUND),
+  MENU_ITEM_CALL("Reset Audio", NULL, runMenuCommand, MENU_CMD_RESET_AUDIO),
+  MENU_ITEM_BACK("Back")
+};
+
+#define LED_COLOR_ITEM(title, mode) \
+  {title, NULL, selectLEDColor, mode, MENU_ACTION_EDIT, MENU_LED_COLOR_SETTING, true, false}
+
+constexpr MenuItem ledMenuItems[] PROGMEM = {
+  MENU_ITEM_CALL("LED Enable: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_LED),
+  LED_COLOR_ITEM("Armed Color", LED_COLOR_ARMED),
+  LED_COLOR_ITEM("Disarmed Color", LED_COLOR_DISARMED),
+  LED_COLOR_ITEM("Transmit Color", LED_COLOR_TRANSMITTING),
+  LED_COLOR_ITEM("Error Color", LED_COLOR_ERROR),
+  LED_COLOR_ITEM("Menu Color", LED_COLOR_MENU),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem failsafeMenuItems[] PROGMEM = {
+  MENU_ITEM_CALL("Enable: ", menuStatusFlag, toggleMenuFlag, MENU_FLAG_FAILSAFE),
+  MENU_ITEM_EDIT("Set Throttle: ", menuStatusFailsafe, 0, MENU_FAILSAFE_THROTTLE_SETTING),
+  MENU_ITEM_EDIT("Set Steering: ", menuStatusFailsafe, 1, MENU_FAILSAFE_STEERING_SETTING),
+  MENU_ITEM_BACK("Back")
+};
+
+constexpr MenuItem infoMenuItems[] PROGMEM = {
+  MENU_ITEM_INFO("Firmware v3.2", NULL),
+  MENU_ITEM_INFO("Free Memory: ", menuStatusFreeMemory),
+  MENU_ITEM_INFO("Range Config: Active", NULL),
+  MENU_ITEM_INFO("Audio System: Active", NULL),
+  MENU_ITEM_BACK("Back")
+};
+
+// Both factory reset dialogs draw their own No/Yes from these
+constexpr MenuItem factoryResetConfirmItems[] PROGMEM = {
+  MENU_ITEM_BACK("No"),
+  MENU_ITEM_SCREEN("Yes", MENU_FACTORY_RESET_FINAL)
+};
+
+constexpr MenuItem factoryResetFinalItems[] PROGMEM = {
+  MENU_ITEM_BACK("No"),
+  MENU_ITEM_SCREEN("YES", MENU_FACTORY_RESET_PROGRESS)
+};
+
+// Node rows - {state, parent, items, itemCount, header, headerStatus, draw, enter, leave}
+#define MENU_LIST(state, parent, items, header) \
+  {state, parent, items, MENU_ITEM_COUNT(items), header, NULL, NULL, NULL, NULL}
+#define MENU_EDITOR(state, parent, header) \
+  {state, parent, NULL, 0, header, NULL, NULL, NULL, NULL}
+#define MENU_SCREEN(state, parent, enter, leave) \
+  {state, parent, NULL, 0, NULL, NULL, NULL, enter, leave}
+
+// In MenuState order
+constexpr MenuNode menuNodes[] PROGMEM = {
+  MENU_SCREEN(MENU_HIDDEN, MENU_HIDDEN, NULL, NULL),
+  MENU_LIST(MENU_MAIN, MENU_HIDDEN, mainMenuItems, "RC TX MENU"),
+  MENU_LIST(MENU_CALIBRATION, MENU_MAIN, calibrationMenuItems, "Calibration"),
+  MENU_LIST(MENU_JOYSTICK_CAL, MENU_CALIBRATION, joystickCalMenuItems, "Joystick Cal"),
+  MENU_LIST(MENU_POTENTIOMETER_CAL, MENU_CALIBRATION, potentiometerCalMenuItems, "Potentiometer Cal"),
+  MENU_LIST(MENU_SETTINGS, MENU_MAIN, settingsMenuItems, "Settings"),
+  MENU_EDITOR(MENU_DEADZONE_SETTING, MENU_SETTINGS, "Deadzone"),
+  MENU_EDITOR(MENU_BRIGHTNESS_SETTING, MENU_SETTINGS, "Brightness"),
+  MENU_LIST(MENU_LED_SETTINGS, MENU_SETTINGS, ledMenuItems, "LED Settings"),
+  MENU_EDITOR(MENU_LED_COLOR_SETTING, MENU_LED_SETTINGS, "LED Color"),
+  MENU_EDITOR(MENU_RADIO_ADDRESS, MENU_SETTINGS, "Radio Address"),
+  MENU_LIST(MENU_FAILSAFE_SETTINGS, MENU_SETTINGS, failsafeMenuItems, "Failsafe"),
+  MENU_EDITOR(MENU_FAILSAFE_THROTTLE_SETTING, MENU_FAILSAFE_SETTINGS, "Failsafe Throttle"),
+  MENU_EDITOR(MENU_FAILSAFE_STEERING_SETTING, MENU_FAILSAFE_SETTINGS, "Failsafe Steering"),
+  MENU_EDITOR(MENU_CHANNEL_SETTINGS, MENU_SETTINGS, "Radio Channel"),
+  MENU_LIST(MENU_RANGE_SETTINGS, MENU_MAIN, rangeMenuItems, "Range Settings"),
+  MENU_EDITOR(MENU_THROTTLE_MIN_SETTING, MENU_RANGE_SETTINGS, "Throttle Min"),
+  MENU_EDITOR(MENU_THROTTLE_MAX_SETTING, MENU_RANGE_SETTINGS, "Throttle Max"),
+  MENU_EDITOR(MENU_STEER_MIN_SETTING, MENU_RANGE_SETTINGS, "Steer Min"),
+  MENU_EDITOR(MENU_STEER_NEUTRAL_SETTING, MENU_RANGE_SETTINGS, "Steer Neutral"),
+  MENU_EDITOR(MENU_STEER_MAX_SETTING, MENU_RANGE_SETTINGS, "Steer Max"),
+  MENU_LIST(MENU_AUDIO_SETTINGS, MENU_MAIN, audioMenuItems, "Audio Settings"),
+  MENU_EDITOR(MENU_AUDIO_VOLUME_SETTING, MENU_AUDIO_SETTINGS, "Audio Volume"),
+  MENU_LIST(MENU_INFO, MENU_MAIN, infoMenuItems, "System Info"),
+  MENU_SCREEN(MENU_CAL_IN_PROGRESS, MENU_CALIBRATION, NULL, NULL),
+  MENU_SCREEN(MENU_CANCEL_CONFIRM, MENU_MAIN, NULL, NULL),
+  MENU_SCREEN(MENU_RADIO_TEST, MENU_MAIN, startRadioTest, resetRadioTest),
+  {MENU_FACTORY_RESET_CONFIRM, MENU_MAIN, factoryResetConfirmItems, MENU_ITEM_COUNT(factoryResetConfirmItems),
+   NULL, NULL, drawFactoryResetConfirm, NULL, NULL},
+  {MENU_FACTORY_RESET_FINAL, MENU_FACTORY_RESET_CONFIRM, factoryResetFinalItems, MENU_ITEM_COUNT(factoryResetFinalItems),
+   NULL, NULL, drawFactoryResetFinal, NULL, NULL},
+  {MENU_FACTORY_RESET_PROGRESS, MENU_MAIN, NULL, 0, NULL, NULL, drawFactoryResetScreen, startFactoryReset, NULL},
+  MENU_SCREEN(MENU_DISPLAY_TEST, MENU_MAIN, startDisplayTest, resetDisplayTest),
+  MENU_SCREEN(MENU_BUTTON_TEST, MENU_MAIN, startButtonTest, resetButtonTest),
+  MENU_LIST(MENU_CURVES, MENU_MAIN, curvesMenuItems, "Curves & Rates"),
+  {MENU_CURVE_CHANNEL, MENU_CURVES, curveChannelMenuItems, MENU_ITEM_COUNT(curveChannelMenuItems),
+   NULL, menuStatusCurveChannel, NULL, NULL, NULL},
+  MENU_EDITOR(MENU_CURVE_EXPO_SETTING, MENU_CURVE_CHANNEL, "Curve Expo"),
+  MENU_EDITOR(MENU_CURVE_RATE_HIGH_SETTING, MENU_CURVE_CHANNEL, "Curve High Rate"),
+  MENU_EDITOR(MENU_CURVE_RATE_LOW_SETTING, MENU_CURVE_CHANNEL, "Curve Low Rate"),
+  MENU_EDITOR(MENU_CURVE_POINTS_SETTING, MENU_CURVE_CHANNEL, "Curve Points"),
+  MENU_LIST(MENU_LOGIC_SWITCHES, MENU_CURVES, logicSwitchesMenuItems, "Logic Switches"),
+  MENU_EDITOR(MENU_LOGIC_SWITCH_SETTING, MENU_LOGIC_SWITCHES, "Logic Switch")
+};
+
+constexpr bool menuNodesInOrder(int index) {
+  return index >= MENU_STATE_COUNT || (menuNodes[index].state == index && menuNodesInOrder(index + 1));
+}
+static_assert(MENU_ITEM_COUNT(menuNodes) == MENU_STATE_COUNT, "One node per MenuState");
+static_assert(menuNodesInOrder(0), "menuNodes[] must follow the MenuState order");
+
+const MenuNode& getMenuNode(int state) {
+  if (state < 0 || state >= MENU_STATE_COUNT) state = MENU_HIDDEN;
+  return menuNodes[state];
+}
+
+// Switch nodes without running hooks (returning from editors, tests, calibration)
+void setCurrentMenu(int state) {
+  currentMenu = (MenuState)state;
+  menuSelection = 0;
+  menuOffset = 0;
+}
+
+// Open a node from one of its parent's items
+void openMenuNode(int state) {
+  setCurrentMenu(state);
+  const MenuNode& node = getMenuNode(state);
+  if (node.enter) node.enter();
+}
+
+void runMenuItem(const MenuItem& item) {
+  switch (item.action) {
+    case MENU_ACTION_SUBMENU:
+      if (item.handler) item.handler(item.arg);
+      openMenuNode(item.target);
+      break;
+    case MENU_ACTION_EDIT:
+      if (item.handler) item.handler(item.arg);
+      startSetting(item.target);
+      break;
+    case MENU_ACTION_CALL:
+      item.handler(item.arg);
+      break;
+    case MENU_ACTION_BACK:
+      goBack();
+      break;
+    case MENU_ACTION_EXIT:
+      exitMenu();
+      break;
+    default:
+      break;
+  }
+}
+
+void runMenuCommand(int command) {
+  switch (command) {
+    case MENU_CMD_SWEEP_CALIBRATION:
+      startSweepCalibration();
+      break;
+    case MENU_CMD_RESET_SETTINGS:
+      resetAllSettings();
+      break;
+    case MENU_CMD_RESET_RANGE:
+      resetRangeSettings();
+      break;
+    case MENU_CMD_RESET_AUDIO:
+      resetAudioSettings();
+      break;
+    case MENU_CMD_RESET_CURVES:
+      resetCurvesToDefaults();
+      break;
+    case MENU_CMD_TEST_SOUND:
+      playTestSound();
+      Serial.println("Playing test sound");
+      break;
+  }
+}
+
+#endif
@@ -0,0 +1,244 @@
+/*
+  mixer.h - Fixed-Point Mixer Matrix
+  RC Transmitter for Teensy 4.0
+
+  Every output channel is offset + sum(weight * input) with Q15 weights
+  (32767 = +100%) over the shaped stick and pot inputs. The mixer runs
+  once per TX tick. On the Cortex-M7 the inner loop uses the SMLAD dual
+  16-bit multiply-accumulate, so each pair of inputs costs one instruction.
+  Outputs 0 and 1 feed the throttle and steering fields of the packet.
+*/
+
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <EEPROM.h>
+#include "config.h"
+
+// EEPROM layout: calibration at 0, curves at 128, mixer at 256, settings at 512
+#define EEPROM_MIXER_ADDRESS 256
+#define MIXER_SIGNATURE 0x313C
+
+#define MIXER_Q15_ONE 32767
+#define MIXER_PERCENT(p) ((int16_t)((p) * MIXER_Q15_ONE / 100))
+
+// Mixer inputs (-1000 to +1000). Must stay an even count for the paired MAC.
+enum MixerInput {
+  MIX_IN_STEERING = 0,   // Right stick X after deadzone, curve and trim
+  MIX_IN_THROTTLE,       // Left stick Y after deadzone, curve and trim
+  MIX_IN_RIGHT_Y,        // Right stick Y after deadzone
+  MIX_IN_LEFT_X,         // Left stick X after deadzone
+  MIX_IN_LEFT_POT,       // Left potentiometer (calibrated)
+  MIX_IN_RIGHT_POT,      // Right potentiometer (calibrated)
+  NUM_MIX_INPUTS
+};
+
+// Mixer output channels
+#define NUM_MIX_OUTPUTS 8
+#define MIX_OUT_THROTTLE 0
+#define MIX_OUT_STEERING 1
+
+// Outputs that actually go on air - the legacy packet only has throttle and steering
+#if USE_CHANNEL_FRAME
+#define MIX_SENT_OUTPUTS NUM_MIX_OUTPUTS
+#else
+#define MIX_SENT_OUTPUTS 2
+#endif
+
+// All presets pass the remaining inputs through on the following channels
+enum MixerPreset {
+  MIX_PRESET_DIRECT = 0,   // Throttle -> CH1, steering -> CH2, RY/LX/pots -> CH3-6
+  MIX_PRESET_TANK,         // Twin motor: CH1 = T + S, CH2 = T - S, RY/LX/pots -> CH3-6
+  MIX_PRESET_ELEVON,       // CH1 = (RY + S) / 2, CH2 = (RY - S) / 2, T/LX/pots -> CH3-6
+  NUM_MIX_PRESETS
+};
+
+// Mixer data stored in EEPROM
+struct MixerData {
+  int16_t weights[NUM_MIX_OUTPUTS][NUM_MIX_INPUTS] __attribute__((aligned(4)));  // Q15
+  int16_t offsets[NUM_MIX_OUTPUTS];                   // -1000 to +1000
+  uint8_t preset;                                     // MixerPreset
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+MixerData mixerData;
+
+// Mixer working buffers (word aligned so input pairs load as one 32-bit word)
+int16_t mixerInputs[NUM_MIX_INPUTS] __attribute__((aligned(4)));
+int16_t mixerOutputs[NUM_MIX_OUTPUTS];
+uint8_t mixerInputsUsed = 0;   // Bit per input referenced by a non-zero weight
+
+// Function declarations
+void initMixer();
+void saveMixer();
+void loadMixer();
+void resetMixer();
+void applyMixerPreset(int preset);
+void setMixerPassthrough(int output, int input);
+void updateMixerInputsUsed();
+bool isMixerInputUsed(int input);
+void runMixer();
+int32_t mixChannel(const int16_t* weights, const int16_t* inputs);
+void benchmarkMixer();
+const char* getMixerPresetName(int preset);
+
+void initMixer() {
+  loadMixer();
+  updateMixerInputsUsed();
+  benchmarkMixer();
+}
+
+void saveMixer() {
+  mixerData.signature = MIXER_SIGNATURE;
+  EEPROM.put(EEPROM_MIXER_ADDRESS, mixerData);
+  Serial.println("Mixer saved to EEPROM");
+}
+
+void loadMixer() {
+  EEPROM.get(EEPROM_MIXER_ADDRESS, mixerData);
+
+  if (mixerData.signature != MIXER_SIGNATURE || mixerData.preset >= NUM_MIX_PRESETS) {
+    Serial.println("No valid mixer found, using defaults");
+    resetMixer();
+  } else {
+    Serial.println("Mixer loaded from EEPROM");
+  }
+}
+
+void resetMixer() {
+  applyMixerPreset(MIX_PRESET_DIRECT);
+  mixerData.signature = MIXER_SIGNATURE;
+}
+
+void applyMixerPreset(int preset) {
+  memset(mixerData.weights, 0, sizeof(mixerData.weights));
+  memset(mixerData.offsets, 0, sizeof(mixerData.offsets));
+
+  switch (preset) {
+    case MIX_PRESET_TANK:
+      mixerData.weights[MIX_OUT_THROTTLE][MIX_IN_THROTTLE] = MIXER_PERCENT(100);
+      mixerData.weights[MIX_OUT_THROTTLE][MIX_IN_STEERING] = MIXER_PERCENT(100);
+      mixerData.weights[MIX_OUT_STEERING][MIX_IN_THROTTLE] = MIXER_PERCENT(100);
+      mixerData.weights[MIX_OUT_STEERING][MIX_IN_STEERING] = MIXER_PERCENT(-100);
+      setMixerPassthrough(2, MIX_IN_RIGHT_Y);
+      break;
+    case MIX_PRESET_ELEVON:
+      mixerData.weights[MIX_OUT_THROTTLE][MIX_IN_RIGHT_Y] = MIXER_PERCENT(50);
+      mixerData.weights[MIX_OUT_THROTTLE][MIX_IN_STEERING] = MIXER_PERCENT(50);
+      mixerData.weights[MIX_OUT_STEERING][MIX_IN_RIGHT_Y] = MIXER_PERCENT(50);
+      mixerData.weights[MIX_OUT_STEERING][MIX_IN_STEERING] = MIXER_PERCENT(-50);
+      setMixerPassthrough(2, MIX_IN_THROTTLE);
+      break;
+    default:
+      preset = MIX_PRESET_DIRECT;
+      mixerData.weights[MIX_OUT_THROTTLE][MIX_IN_THROTTLE] = MIXER_PERCENT(100);
+      mixerData.weights[MIX_OUT_STEERING][MIX_IN_STEERING] = MIXER_PERCENT(100);
+      setMixerPassthrough(2, MIX_IN_RIGHT_Y);
+      break;
+  }
+  
+  // Auxiliary channels
+  setMixerPassthrough(3, MIX_IN_LEFT_X);
+  setMixerPassthrough(4, MIX_IN_LEFT_POT);
+  setMixerPassthrough(5, MIX_IN_RIGHT_POT);
+
+  mixerData.preset = preset;
+  updateMixerInputsUsed();
+
+  Serial.print("Mixer preset: ");
+  Serial.println(getMixerPresetName(preset));
+}
+
+void setMixerPassthrough(int output, int input) {
+  mixerData.weights[output][input] = MIXER_PERCENT(100);
+}
+
+// Only inputs with a non-zero weight on a transmitted output are sampled each tick
+void updateMixerInputsUsed() {
+  mixerInputsUsed = 0;
+  for (int out = 0; out < MIX_SENT_OUTPUTS; out++) {
+    for (int in = 0; in < NUM_MIX_INPUTS; in++) {
+      if (mixerData.weights[out][in] != 0) mixerInputsUsed |= (1 << in);
+    }
+  }
+}
+
+bool isMixerInputUsed(int input) {
+  return mixerInputsUsed & (1 << input);
+}
+
+// One output: sum of weight * input in Q15, returned in input units
+int32_t mixChannel(const int16_t* weights, const int16_t* inputs) {
+  int32_t acc = 0;
+
+#if defined(__ARM_FEATURE_DSP)
+  // SMLAD: acc += w.lo * in.lo + w.hi * in.hi
+  for (int i = 0; i < NUM_MIX_INPUTS; i += 2) {
+    uint32_t w, x;
+    memcpy(&w, &weights[i], sizeof(w));
+    memcpy(&x, &inputs[i], sizeof(x));
+    asm("smlad %0, %1, %2, %0" : "+r"(acc) : "r"(w), "r"(x));
+  }
+#else
+  for (int i = 0; i < NUM_MIX_INPUTS; i++) {
+    acc += (int32_t)weights[i] * inputs[i];
+  }
+#endif
+
+  // Round to nearest (|acc| < 2^31 for 6 inputs of +-1000 at +-100%)
+  return (acc + (1 << 14)) >> 15;
+}
+
+// Evaluate the transmitted outputs from mixerInputs[] into mixerOutputs[]
+void runMixer() {
+  for (int out = 0; out < MIX_SENT_OUTPUTS; out++) {
+    int32_t value = mixerData.offsets[out] + mixChannel(mixerData.weights[out], mixerInputs);
+    mixerOutputs[out] = constrain(value, -1000, 1000);
+  }
+}
+
+// Cycle count of a full mixer pass, printed at startup
+void benchmarkMixer() {
+  const int iterations = 1000;
+  int16_t savedInputs[NUM_MIX_INPUTS];
+  memcpy(savedInputs, mixerInputs, sizeof(savedInputs));
+
+  for (int i = 0; i < NUM_MIX_INPUTS; i++) {
+    mixerInputs[i] = (i * 397) % 2001 - 1000;
+  }
+
+  uint32_t start = ARM_DWT_CYCCNT;
+  for (int i = 0; i < iterations; i++) {
+    mixerInputs[0] = i - 500;  // Keep the compiler from hoisting the work
+    runMixer();
+  }
+  uint32_t cycles = ARM_DWT_CYCCNT - start;
+
+  memcpy(mixerInputs, savedInputs, sizeof(savedInputs));
+
+  Serial.print("Mixer benchmark (");
+#if defined(__ARM_FEATURE_DSP)
+  Serial.print("SMLAD");
+#else
+  Serial.print("scalar");
+#endif
+  Serial.print("): ");
+  Serial.print(cycles / iterations);
+  Serial.print(" cycles per ");
+  Serial.print(NUM_MIX_INPUTS);
+  Serial.print("x");
+  Serial.print(MIX_SENT_OUTPUTS);
+  Serial.println(" mix");
+}
+
+const char* getMixerPresetName(int preset) {
+  switch (preset) {
+    case MIX_PRESET_TANK: return "TANK";
+    case MIX_PRESET_ELEVON: return "ELEVON";
+    default: return "DIRECT";
+  }
+}
+
+#endif
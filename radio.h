@@ -32,6 +32,7 @@ uint32_t getFailedAcks();
 uint32_t getCycleCounter();
 float getAckSuccessRate();
 void resetCountersIfNeeded();
+bool writeControlPacket();
 
 // Radio implementation
 RF24 radio(RADIO_CE, RADIO_CSN);
@@ -86,7 +87,13 @@ void transmitData() {
   data.counter++;
   totalPacketsSent++;
   
-  bool result = radio.write(&data, sizeof(data));
+#if USE_LATENCY_PROBE
+  markRadioHandoff();
+#endif
+  bool result = writeControlPacket();
+#if USE_LATENCY_PROBE
+  markRadioWriteDone();
+#endif
   
   // Track ACK results
   if (result) {
@@ -126,6 +133,28 @@ void transmitData() {
   }
 }
 
+// Send the current controls in the configured packet format
+bool writeControlPacket() {
+#if USE_CHANNEL_FRAME
+  ChannelFrame frame;
+  memcpy(frame.channels, mixerOutputs, sizeof(frame.channels));
+  frame.switches = getSwitchBits();
+  frame.counter = data.counter;
+  frame.throttleMinPWM = data.throttle_min_pwm;
+  frame.throttleMaxPWM = data.throttle_max_pwm;
+  frame.steerMinDegree = data.steer_min_degree;
+  frame.steerNeutralDegree = data.steer_neutral_degree;
+  frame.steerMaxDegree = data.steer_max_degree;
+  frame.configChanged = data.config_changed;
+  
+  uint8_t payload[CHANNEL_FRAME_SIZE];
+  encodeChannelFrame(frame, payload);
+  return radio.write(payload, sizeof(payload));
+#else
+  return radio.write(&data, sizeof(data));
+#endif
+}
+
 void resetCountersIfNeeded() {
   if (totalPacketsSent >= 9999) {
     cycleCounter++;
@@ -135,7 +135,7 @@ void drawRadioTestScreen() {
   display.print("#  Ideal Yours");
   
   // Define register names and their data
-  String regNames[] = {"AA", "AD", "CH", "ST", "CF"};
+  static const char* const regNames[] = {"AA", "AD", "CH", "ST", "CF"};
   uint8_t expectedVals[] = {expectedValues.reg_EN_AA, expectedValues.reg_EN_RXADDR, 
                            expectedValues.reg_RF_CH, expectedValues.reg_RF_SETUP, expectedValues.reg_CONFIG};
   uint8_t actualVals[] = {testResults.reg_EN_AA, testResults.reg_EN_RXADDR,
@@ -190,8 +190,6 @@ void drawRadioTestScreen() {
     display.print("Press any key to exit");
     display.setTextColor(SSD1306_WHITE); // Reset text color
   }
-  
-  display.display();
 }
 
 bool isRadioTestCompleted() {
@@ -0,0 +1,133 @@
+/*
+  slew.h - Per-Channel Slew-Rate Limiter
+  RC Transmitter for Teensy 4.0
+
+  Limits how fast each mixer output may move, in units (of the
+  -1000..+1000 range) per second. The limiter runs in the TX tick on the
+  measured time since the previous tick, so the ramp is the same at any
+  transmit rate. Channel state is kept in Q16 so slow rates still move
+  smoothly at 50 Hz. Disarming bypasses the limiter: the outputs drop to
+  neutral at once and the next arm ramps up from there.
+*/
+
+#ifndef SLEW_H
+#define SLEW_H
+
+#include <EEPROM.h>
+#include "config.h"
+#include "mixer.h"
+
+// EEPROM layout: ... trims at 448, slew rates at 488, settings at 512
+#define EEPROM_SLEW_ADDRESS 488
+#define SLEW_SIGNATURE 0x51E7
+
+#define SLEW_MAX_DT_US 100000UL     // Longer gaps (first tick, blocking menu work) count as 100 ms
+
+// Rates offered by the menu (0 = off)
+const uint16_t slewRatePresets[] = {0, 250, 500, 1000, 2000, 4000};
+#define NUM_SLEW_PRESETS (sizeof(slewRatePresets) / sizeof(slewRatePresets[0]))
+
+// Slew data stored in EEPROM
+struct SlewData {
+  uint16_t rate[NUM_MIX_OUTPUTS];   // Units per second, 0 = no limit
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+SlewData slewData;
+
+// Limiter state
+int32_t slewStateQ16[NUM_MIX_OUTPUTS];   // Current output << 16
+uint32_t slewLastMicros = 0;
+
+// Function declarations
+void initSlew();
+void saveSlew();
+void loadSlew();
+void resetSlew();
+void resetSlewState();
+void applySlew(int16_t* outputs, int count);
+void cycleSlewRate(int output);
+const char* getSlewRateName(int output);
+
+void initSlew() {
+  loadSlew();
+  resetSlewState();
+}
+
+void saveSlew() {
+  slewData.signature = SLEW_SIGNATURE;
+  EEPROM.put(EEPROM_SLEW_ADDRESS, slewData);
+  Serial.println("Slew rates saved to EEPROM");
+}
+
+void loadSlew() {
+  EEPROM.get(EEPROM_SLEW_ADDRESS, slewData);
+
+  if (slewData.signature != SLEW_SIGNATURE) {
+    Serial.println("No valid slew rates found, using defaults");
+    resetSlew();
+  } else {
+    Serial.println("Slew rates loaded from EEPROM");
+  }
+}
+
+void resetSlew() {
+  memset(slewData.rate, 0, sizeof(slewData.rate));
+  slewData.signature = SLEW_SIGNATURE;
+}
+
+// Bypass - jump every channel to neutral (used while disarmed)
+void resetSlewState() {
+  memset(slewStateQ16, 0, sizeof(slewStateQ16));
+  slewLastMicros = micros();
+}
+
+// Move each output towards its target by at most rate * dt
+void applySlew(int16_t* outputs, int count) {
+  uint32_t now = micros();
+  uint32_t dt = now - slewLastMicros;
+  slewLastMicros = now;
+  if (dt > SLEW_MAX_DT_US) dt = SLEW_MAX_DT_US;
+
+  for (int ch = 0; ch < count; ch++) {
+    int32_t target = (int32_t)outputs[ch] << 16;
+    uint16_t rate = slewData.rate[ch];
+
+    if (rate == 0) {
+      slewStateQ16[ch] = target;
+      continue;
+    }
+
+    // Step in Q16: rate [units/s] * dt [us] / 1e6
+    int32_t maxStep = (int32_t)(((uint64_t)rate * dt << 16) / 1000000UL);
+    int32_t diff = target - slewStateQ16[ch];
+    if (diff > maxStep) diff = maxStep;
+    else if (diff < -maxStep) diff = -maxStep;
+    slewStateQ16[ch] += diff;
+
+    outputs[ch] = (int16_t)((slewStateQ16[ch] + 0x8000) >> 16);
+  }
+}
+
+void cycleSlewRate(int output) {
+  unsigned int preset = 0;
+  while (preset < NUM_SLEW_PRESETS && slewRatePresets[preset] != slewData.rate[output]) preset++;
+  preset = (preset + 1) % NUM_SLEW_PRESETS;   // Unknown rates restart at OFF
+  slewData.rate[output] = slewRatePresets[preset];
+
+  Serial.print("Slew rate for output ");
+  Serial.print(output);
+  Serial.print(": ");
+  Serial.println(getSlewRateName(output));
+}
+
+const char* getSlewRateName(int output) {
+  static char name[8];
+  if (slewData.rate[output] == 0) return "OFF";
+  snprintf(name, sizeof(name), "%u/s", slewData.rate[output]);
+  return name;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/*
+  stats.h - Running Sample Statistics
+  RC Transmitter for Teensy 4.0
+
+  Welford's online mean/variance plus min/max, so long sample runs need
+  no buffer and stay numerically stable. Used by the ADC noise analyzer
+  in the input test and for the neutral phase of the sweep calibration.
+*/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <math.h>
+#include <stdint.h>
+
+struct RunningStats {
+  uint32_t count;
+  float mean;
+  float m2;         // Sum of squared deviations from the mean
+  int minValue;
+  int maxValue;
+};
+
+// Function declarations
+void resetRunningStats(RunningStats& stats);
+void addRunningSample(RunningStats& stats, int value);
+float getRunningStdDev(const RunningStats& stats);
+int getRunningPeakToPeak(const RunningStats& stats);
+
+void resetRunningStats(RunningStats& stats) {
+  stats.count = 0;
+  stats.mean = 0;
+  stats.m2 = 0;
+  stats.minValue = INT16_MAX;
+  stats.maxValue = INT16_MIN;
+}
+
+void addRunningSample(RunningStats& stats, int value) {
+  stats.count++;
+  float delta = value - stats.mean;
+  stats.mean += delta / stats.count;
+  stats.m2 += delta * (value - stats.mean);
+  if (value < stats.minValue) stats.minValue = value;
+  if (value > stats.maxValue) stats.maxValue = value;
+}
+
+// Sample standard deviation
+float getRunningStdDev(const RunningStats& stats) {
+  if (stats.count < 2) return 0;
+  return sqrtf(stats.m2 / (stats.count - 1));
+}
+
+int getRunningPeakToPeak(const RunningStats& stats) {
+  return stats.count ? stats.maxValue - stats.minValue : 0;
+}
+
+#endif
@@ -10,6 +10,12 @@
   - Joystick buttons (Left, Right)
   - Trigger switches (Left Up/Down, Right Up/Down)
   
+  Noise analysis: Press Left Arrow + Right Arrow together. Every axis is
+  sampled NOISE_TARGET_SAMPLES times into running stats and a histogram
+  around its mean; the table shows std-dev, peak-to-peak and effective
+  bits, and flags axes noisy enough to point at a worn pot.
+  OK switches between the table and the per-axis histograms.
+  
   Exit: Press Up Arrow + Down Arrow together
 */
 
@@ -19,32 +25,17 @@
 #include "config.h"
 #include "display.h"
 #include "controls.h"
-
-// Trigger state enum
-enum TriggerState {
-  TRIGGER_UP = 0,
-  TRIGGER_MIDDLE = 1,
-  TRIGGER_DOWN = 2
-};
+#include "stats.h"
 
 // Button test variables
 bool buttonTestActive = false;
 unsigned long buttonTestStartTime = 0;
-bool lastUpArrow = false;
-bool lastDownArrow = false;
 bool exitCombinationDetected = false;
 
 // Test result tracking
 struct InputTestResults {
-  // Joystick movement detection
-  bool leftJoyXMoved = false;
-  bool leftJoyYMoved = false;
-  bool rightJoyXMoved = false;
-  bool rightJoyYMoved = false;
-  
-  // Potentiometer movement detection
-  bool leftPotMoved = false;
-  bool rightPotMoved = false;
+  // Joystick and potentiometer movement detection (AxisId order)
+  bool axisMoved[NUM_AXES] = {};
   
   // Button states
   bool arrowUp = false;
@@ -65,16 +56,7 @@ struct InputTestResults {
 InputTestResults inputTestResults;
 
 // Previous values for movement detection
-struct PreviousValues {
-  int leftJoyX = 512;
-  int leftJoyY = 512;
-  int rightJoyX = 512;
-  int rightJoyY = 512;
-  int leftPot = 512;
-  int rightPot = 512;
-};
-
-PreviousValues prevValues;
+int prevAxisValues[NUM_AXES];
 
 // Display page management
 int buttonTestPage = 0;
@@ -82,6 +64,23 @@ unsigned long pageChangeTime = 0;
 #define BUTTON_TEST_PAGES 4
 #define PAGE_DURATION 3000
 
+// ADC noise analyzer
+#define NOISE_TARGET_SAMPLES 4096     // Samples per axis
+#define NOISE_ROUNDS_PER_UPDATE 16    // Sampling rounds over all axes per update
+#define NOISE_HIST_WARMUP 256         // Samples before the histogram centre is fixed
+#define NOISE_HIST_HALF_WIDTH 16      // Histogram covers mean +-16 counts
+#define NOISE_HIST_BINS (2 * NOISE_HIST_HALF_WIDTH + 1)
+#define NOISE_WORN_SIGMA 3.0f         // Std-dev (counts) that flags an axis
+#define NOISE_WORN_PEAK_TO_PEAK 16    // Peak-to-peak (counts) that flags an axis
+#define ADC_FULL_SCALE 1024           // 10-bit analogRead
+
+bool noiseTestActive = false;
+int noiseView = -1;                   // -1 = table, otherwise AxisId of the histogram shown
+bool noiseReported = false;
+RunningStats noiseStats[NUM_AXES];
+uint16_t noiseHistogram[NUM_AXES][NOISE_HIST_BINS];
+int noiseHistCentre[NUM_AXES];
+
 // Function declarations
 void startButtonTest();
 void updateButtonTest();
@@ -89,15 +88,20 @@ void drawButtonTestScreen();
 void resetButtonTest();
 bool isButtonTestActive();
 void checkAllButtons();
-void checkJoysticks();
-void checkPotentiometers();
+void checkAxes();
 void drawButtonTestPage0();
 void drawButtonTestPage1();
 void drawButtonTestPage2();
 void drawButtonTestPage3();
-TriggerState readTriggerState(int upPin, int downPin);
-String triggerStateToString(TriggerState state);
-String getCurrentActiveInput();
+void startNoiseTest();
+void updateNoiseTest();
+float getNoiseEffectiveBits(int axis);
+bool isNoiseWorn(int axis);
+void reportNoiseTest();
+void drawNoiseTable();
+void drawNoiseHistogram(int axis);
+const char* triggerStateToString(TriggerState state);
+const char* getCurrentActiveInput();
 
 void startButtonTest() {
   Serial.println("Starting complete input test...");
@@ -106,14 +110,12 @@ void startButtonTest() {
   buttonTestPage = 0;
   pageChangeTime = millis();
   exitCombinationDetected = false;
+  noiseTestActive = false;
   
   // Reset all test results
-  inputTestResults.leftJoyXMoved = false;
-  inputTestResults.leftJoyYMoved = false;
-  inputTestResults.rightJoyXMoved = false;
-  inputTestResults.rightJoyYMoved = false;
-  inputTestResults.leftPotMoved = false;
-  inputTestResults.rightPotMoved = false;
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    inputTestResults.axisMoved[axis] = false;
+  }
   inputTestResults.arrowUp = false;
   inputTestResults.arrowDown = false;
   inputTestResults.arrowLeft = false;
@@ -127,13 +129,11 @@ void startButtonTest() {
   inputTestResults.rightTriggerDown = false;
   
   // Initialize previous values
-  prevValues.leftJoyX = analogRead(A1);
-  prevValues.leftJoyY = analogRead(A0);
-  prevValues.rightJoyX = analogRead(A2);
-  prevValues.rightJoyY = analogRead(A3);
-  prevValues.leftPot = analogRead(A6);
-  prevValues.rightPot = analogRead(A7);
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    prevAxisValues[axis] = analogRead(axisTable[axis].pin);
+  }
   
+  Serial.println("Press LEFT + RIGHT arrows together for noise analysis");
   Serial.println("Press UP + DOWN arrows together to exit test");
 }
 
@@ -141,106 +141,152 @@ void updateButtonTest() {
   if (!buttonTestActive) return;
   
   // Check all inputs
-  checkJoysticks();
-  checkPotentiometers();
+  checkAxes();
   checkAllButtons();
   
-  // Auto-cycle through display pages
-  if (millis() - pageChangeTime >= PAGE_DURATION) {
+  // Toggle noise analysis (Left + Right arrows) - completed by a fresh press of either
+  if (isButtonDown(BTN_LEFT) && isButtonDown(BTN_RIGHT) &&
+      (wasButtonPressed(BTN_LEFT) || wasButtonPressed(BTN_RIGHT))) {
+    if (noiseTestActive) {
+      noiseTestActive = false;
+      pageChangeTime = millis();
+      Serial.println("Noise analysis stopped");
+    } else {
+      startNoiseTest();
+    }
+  }
+  
+  if (noiseTestActive) {
+    updateNoiseTest();
+  } else if (millis() - pageChangeTime >= PAGE_DURATION) {
+    // Auto-cycle through display pages
     buttonTestPage = (buttonTestPage + 1) % BUTTON_TEST_PAGES;
     pageChangeTime = millis();
   }
   
-  // Check for exit combination (Up + Down arrows)
-  extern ButtonStates buttons;
-  bool currentUpArrow = buttons.btnUp;
-  bool currentDownArrow = buttons.btnDown;
-  
-  if (currentUpArrow && currentDownArrow && (!lastUpArrow || !lastDownArrow)) {
+  // Check for exit combination (Up + Down arrows) - completed by a fresh press of either
+  if (isButtonDown(BTN_UP) && isButtonDown(BTN_DOWN) &&
+      (wasButtonPressed(BTN_UP) || wasButtonPressed(BTN_DOWN))) {
     exitCombinationDetected = true;
     Serial.println("Exit combination detected - Up + Down arrows pressed");
   }
   
-  lastUpArrow = currentUpArrow;
-  lastDownArrow = currentDownArrow;
-  
   // Exit test if combination was detected
   if (exitCombinationDetected) {
     buttonTestActive = false;
+    noiseTestActive = false;
     
     // Return to main menu
-    extern MenuState currentMenu;
-    extern int maxMenuItems;
-    extern int menuSelection;
-    extern int menuOffset;
-    currentMenu = MENU_MAIN;
-    maxMenuItems = 9;
-    menuSelection = 0;
-    menuOffset = 0;
+    setCurrentMenu(MENU_MAIN);
     
     Serial.println("Input test exited - returning to main menu");
   }
 }
 
-void checkJoysticks() {
-  int leftJoyX = analogRead(A1);
-  int leftJoyY = analogRead(A0);
-  int rightJoyX = analogRead(A2);
-  int rightJoyY = analogRead(A3);
-  
-  if (abs(leftJoyX - prevValues.leftJoyX) > 50) {
-    inputTestResults.leftJoyXMoved = true;
-    prevValues.leftJoyX = leftJoyX;
+void checkAxes() {
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    int value = analogRead(axisTable[axis].pin);
+    if (abs(value - prevAxisValues[axis]) > 50) {
+      inputTestResults.axisMoved[axis] = true;
+      prevAxisValues[axis] = value;
+    }
+  }
+}
+
+void startNoiseTest() {
+  noiseTestActive = true;
+  noiseView = -1;
+  noiseReported = false;
+  
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    resetRunningStats(noiseStats[axis]);
+    memset(noiseHistogram[axis], 0, sizeof(noiseHistogram[axis]));
+    noiseHistCentre[axis] = 0;
   }
   
-  if (abs(leftJoyY - prevValues.leftJoyY) > 50) {
-    inputTestResults.leftJoyYMoved = true;
-    prevValues.leftJoyY = leftJoyY;
+  Serial.println("Noise analysis started - leave all sticks and pots untouched");
+}
+
+void updateNoiseTest() {
+  // OK cycles table -> histogram of each axis -> table
+  if (wasButtonPressed(BTN_OK)) {
+    noiseView++;
+    if (noiseView >= NUM_AXES) noiseView = -1;
   }
   
-  if (abs(rightJoyX - prevValues.rightJoyX) > 50) {
-    inputTestResults.rightJoyXMoved = true;
-    prevValues.rightJoyX = rightJoyX;
+  // A short burst per update keeps the screen and buttons responsive
+  for (int round = 0; round < NOISE_ROUNDS_PER_UPDATE; round++) {
+    for (int axis = 0; axis < NUM_AXES; axis++) {
+      RunningStats& stats = noiseStats[axis];
+      if (stats.count >= NOISE_TARGET_SAMPLES) continue;
+      
+      int value = analogRead(axisTable[axis].pin);
+      addRunningSample(stats, value);
+      
+      if (stats.count == NOISE_HIST_WARMUP) {
+        noiseHistCentre[axis] = (int)(stats.mean + 0.5f);
+      }
+      if (stats.count >= NOISE_HIST_WARMUP) {
+        // Samples outside the window pile up in the end bins
+        int bin = constrain(value - noiseHistCentre[axis], -NOISE_HIST_HALF_WIDTH, NOISE_HIST_HALF_WIDTH);
+        uint16_t& count = noiseHistogram[axis][bin + NOISE_HIST_HALF_WIDTH];
+        if (count < UINT16_MAX) count++;
+      }
+    }
   }
   
-  if (abs(rightJoyY - prevValues.rightJoyY) > 50) {
-    inputTestResults.rightJoyYMoved = true;
-    prevValues.rightJoyY = rightJoyY;
+  if (!noiseReported && noiseStats[NUM_AXES - 1].count >= NOISE_TARGET_SAMPLES) {
+    noiseReported = true;
+    reportNoiseTest();
   }
 }
 
-void checkPotentiometers() {
-  int leftPot = analogRead(A6);
-  int rightPot = analogRead(A7);
-  
-  if (abs(leftPot - prevValues.leftPot) > 50) {
-    inputTestResults.leftPotMoved = true;
-    prevValues.leftPot = leftPot;
-  }
-  
-  if (abs(rightPot - prevValues.rightPot) > 50) {
-    inputTestResults.rightPotMoved = true;
-    prevValues.rightPot = rightPot;
+// Effective number of bits: full scale over the RMS noise of an ideal quantizer (sigma * sqrt(12))
+float getNoiseEffectiveBits(int axis) {
+  float sigma = getRunningStdDev(noiseStats[axis]);
+  const float maxBits = log2f(ADC_FULL_SCALE);
+  if (sigma <= 0) return maxBits;
+  return constrain(log2f(ADC_FULL_SCALE / (sigma * sqrtf(12.0f))), 0.0f, maxBits);
+}
+
+bool isNoiseWorn(int axis) {
+  return getRunningStdDev(noiseStats[axis]) > NOISE_WORN_SIGMA ||
+         getRunningPeakToPeak(noiseStats[axis]) > NOISE_WORN_PEAK_TO_PEAK;
+}
+
+void reportNoiseTest() {
+  Serial.println("=== ADC Noise Analysis ===");
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    const RunningStats& stats = noiseStats[axis];
+    Serial.print(axisTable[axis].label);
+    Serial.print(": mean ");
+    Serial.print(stats.mean, 1);
+    Serial.print(", std-dev ");
+    Serial.print(getRunningStdDev(stats), 2);
+    Serial.print(", p-p ");
+    Serial.print(getRunningPeakToPeak(stats));
+    Serial.print(", ");
+    Serial.print(getNoiseEffectiveBits(axis), 1);
+    Serial.print(" bits");
+    Serial.println(isNoiseWorn(axis) ? "  <-- WORN?" : "");
   }
 }
 
 void checkAllButtons() {
-  extern ButtonStates buttons;
-  
   // Check arrow buttons
-  if (buttons.btnUp) inputTestResults.arrowUp = true;
-  if (buttons.btnDown) inputTestResults.arrowDown = true;
-  if (buttons.btnLeft) inputTestResults.arrowLeft = true;
-  if (buttons.btnRight) inputTestResults.arrowRight = true;
-  if (buttons.btnOK) inputTestResults.okButton = true;
+  if (isButtonDown(BTN_UP)) inputTestResults.arrowUp = true;
+  if (isButtonDown(BTN_DOWN)) inputTestResults.arrowDown = true;
+  if (isButtonDown(BTN_LEFT)) inputTestResults.arrowLeft = true;
+  if (isButtonDown(BTN_RIGHT)) inputTestResults.arrowRight = true;
+  if (isButtonDown(BTN_OK)) inputTestResults.okButton = true;
   
   // Check joystick buttons
-  if (buttons.leftJoyBtn) inputTestResults.leftJoyBtn = true;
-  if (buttons.rightJoyBtn) inputTestResults.rightJoyBtn = true;
+  if (isButtonDown(BTN_LEFT_JOY)) inputTestResults.leftJoyBtn = true;
+  if (isButtonDown(BTN_RIGHT_JOY)) inputTestResults.rightJoyBtn = true;
   
   // Check triggers
-  TriggerState leftTrigger = readTriggerState(25, 28);
-  TriggerState rightTrigger = readTriggerState(0, 1);
+  TriggerState leftTrigger = readTriggerState(BTN_LEFT_TRIGGER_UP, BTN_LEFT_TRIGGER_DOWN);
+  TriggerState rightTrigger = readTriggerState(BTN_RIGHT_TRIGGER_UP, BTN_RIGHT_TRIGGER_DOWN);
   
   if (leftTrigger == TRIGGER_UP) inputTestResults.leftTriggerUp = true;
   if (leftTrigger == TRIGGER_DOWN) inputTestResults.leftTriggerDown = true;
@@ -248,16 +294,7 @@ void checkAllButtons() {
   if (rightTrigger == TRIGGER_DOWN) inputTestResults.rightTriggerDown = true;
 }
 
-TriggerState readTriggerState(int upPin, int downPin) {
-  bool up = digitalRead(upPin);
-  bool down = digitalRead(downPin);
-  
-  if (!up && down) return TRIGGER_UP;
-  if (up && !down) return TRIGGER_DOWN;
-  return TRIGGER_MIDDLE;
-}
-
-String triggerStateToString(TriggerState state) {
+const char* triggerStateToString(TriggerState state) {
   switch (state) {
     case TRIGGER_UP: return "UP";
     case TRIGGER_DOWN: return "DOWN";
@@ -266,45 +303,49 @@ String triggerStateToString(TriggerState state) {
   }
 }
 
-String getCurrentActiveInput() {
-  static int lastValues[6] = {512, 512, 512, 512, 512, 512};
-  
-  int currentValues[6] = {
-    analogRead(A1), analogRead(A0), analogRead(A2), 
-    analogRead(A3), analogRead(A6), analogRead(A7)
-  };
-  
-  String names[6] = {"L-Joy X", "L-Joy Y", "R-Joy X", "R-Joy Y", "L-Pot", "R-Pot"};
+// Formatted into a static buffer - drawn every frame, so no String allocations
+const char* getCurrentActiveInput() {
+  static char activeText[24];
+  static int lastValues[NUM_AXES] = {512, 512, 512, 512, 512, 512};
   
   int maxChange = 0;
   int activeIndex = -1;
+  int activeValue = 0;
   
-  for (int i = 0; i < 6; i++) {
-    int change = abs(currentValues[i] - lastValues[i]);
+  for (int i = 0; i < NUM_AXES; i++) {
+    int value = analogRead(axisTable[i].pin);
+    int change = abs(value - lastValues[i]);
     if (change > maxChange && change > 10) {
       maxChange = change;
       activeIndex = i;
+      activeValue = value;
     }
-    lastValues[i] = currentValues[i];
+    lastValues[i] = value;
   }
   
   if (activeIndex >= 0) {
-    return names[activeIndex] + ":" + String(currentValues[activeIndex]);
+    snprintf(activeText, sizeof(activeText), "%s:%d", axisTable[activeIndex].label, activeValue);
+    return activeText;
   }
   
-  extern ButtonStates buttons;
-  if (buttons.btnUp) return "UP Button";
-  if (buttons.btnDown) return "DOWN Button"; 
-  if (buttons.btnLeft) return "LEFT Button";
-  if (buttons.btnRight) return "RIGHT Button";
-  if (buttons.btnOK) return "OK Button";
-  if (buttons.leftJoyBtn) return "L-Joy Btn";
-  if (buttons.rightJoyBtn) return "R-Joy Btn";
-  
-  TriggerState leftTrig = readTriggerState(25, 28);
-  TriggerState rightTrig = readTriggerState(0, 1);
-  if (leftTrig != TRIGGER_MIDDLE) return "L-Trig:" + triggerStateToString(leftTrig);
-  if (rightTrig != TRIGGER_MIDDLE) return "R-Trig:" + triggerStateToString(rightTrig);
+  if (isButtonDown(BTN_UP)) return "UP Button";
+  if (isButtonDown(BTN_DOWN)) return "DOWN Button"; 
+  if (isButtonDown(BTN_LEFT)) return "LEFT Button";
+  if (isButtonDown(BTN_RIGHT)) return "RIGHT Button";
+  if (isButtonDown(BTN_OK)) return "OK Button";
+  if (isButtonDown(BTN_LEFT_JOY)) return "L-Joy Btn";
+  if (isButtonDown(BTN_RIGHT_JOY)) return "R-Joy Btn";
+  
+  TriggerState leftTrig = readTriggerState(BTN_LEFT_TRIGGER_UP, BTN_LEFT_TRIGGER_DOWN);
+  TriggerState rightTrig = readTriggerState(BTN_RIGHT_TRIGGER_UP, BTN_RIGHT_TRIGGER_DOWN);
+  if (leftTrig != TRIGGER_MIDDLE) {
+    snprintf(activeText, sizeof(activeText), "L-Trig:%s", triggerStateToString(leftTrig));
+    return activeText;
+  }
+  if (rightTrig != TRIGGER_MIDDLE) {
+    snprintf(activeText, sizeof(activeText), "R-Trig:%s", triggerStateToString(rightTrig));
+    return activeText;
+  }
   
   return "No Activity";
 }
@@ -312,6 +353,15 @@ String getCurrentActiveInput() {
 void drawButtonTestScreen() {
   display.clearDisplay();
   
+  if (noiseTestActive) {
+    if (noiseView < 0) {
+      drawNoiseTable();
+    } else {
+      drawNoiseHistogram(noiseView);
+    }
+    return;
+  }
+  
   // YELLOW REGION (0-15): Show current activity
   display.setTextSize(1);
   display.setCursor(0, 0);
@@ -340,8 +390,6 @@ void drawButtonTestScreen() {
       drawButtonTestPage3();
       break;
   }
-  
-  display.display();
 }
 
 void drawButtonTestPage0() {
@@ -349,25 +397,17 @@ void drawButtonTestPage0() {
   display.setCursor(0, 16);
   display.println("JOYSTICKS");
   
-  display.setCursor(0, 26);
-  display.print("LX:");
-  display.print(analogRead(A1));
-  display.print(inputTestResults.leftJoyXMoved ? " OK" : " --");
-  
-  display.setCursor(65, 26);
-  display.print("LY:");
-  display.print(analogRead(A0));
-  display.print(inputTestResults.leftJoyYMoved ? " OK" : " --");
-  
-  display.setCursor(0, 36);
-  display.print("RX:");
-  display.print(analogRead(A2));
-  display.print(inputTestResults.rightJoyXMoved ? " OK" : " --");
-  
-  display.setCursor(65, 36);
-  display.print("RY:");
-  display.print(analogRead(A3));
-  display.print(inputTestResults.rightJoyYMoved ? " OK" : " --");
+  // Two columns, stick axes in table order
+  int row = 0;
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    if (axisTable[axis].kind != AXIS_KIND_STICK) continue;
+    display.setCursor((row % 2) * 65, 26 + (row / 2) * 10);
+    display.print(axisTable[axis].shortLabel);
+    display.print(":");
+    display.print(analogRead(axisTable[axis].pin));
+    display.print(inputTestResults.axisMoved[axis] ? " OK" : " --");
+    row++;
+  }
   
   display.setCursor(0, 48);
   display.println("Move sticks to test");
@@ -378,15 +418,16 @@ void drawButtonTestPage1() {
   display.setCursor(0, 16);
   display.println("POTENTIOMETERS");
   
-  display.setCursor(0, 28);
-  display.print("L-Pot:");
-  display.print(analogRead(A6));
-  display.println(inputTestResults.leftPotMoved ? " OK" : " --");
-  
-  display.setCursor(0, 38);
-  display.print("R-Pot:");
-  display.print(analogRead(A7));
-  display.println(inputTestResults.rightPotMoved ? " OK" : " --");
+  int row = 0;
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    if (axisTable[axis].kind != AXIS_KIND_POT) continue;
+    display.setCursor(0, 28 + row * 10);
+    display.print(axisTable[axis].label);
+    display.print(":");
+    display.print(analogRead(axisTable[axis].pin));
+    display.println(inputTestResults.axisMoved[axis] ? " OK" : " --");
+    row++;
+  }
   
   display.setCursor(0, 50);
   display.println("Turn pots to test");
@@ -454,12 +495,92 @@ void drawButtonTestPage3() {
   display.println("Test triggers & buttons");
 }
 
+void drawNoiseTable() {
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print("NOISE ");
+  display.print(noiseStats[NUM_AXES - 1].count);
+  display.print("/");
+  display.print(NOISE_TARGET_SAMPLES);
+  display.print(" OK:Hist");
+  
+  display.setCursor(18, 8);
+  display.print("SD    P-P Bits");
+  
+  for (int axis = 0; axis < NUM_AXES; axis++) {
+    int y = 16 + axis * 8;
+    display.setCursor(0, y);
+    display.print(axisTable[axis].shortLabel);
+    
+    if (noiseStats[axis].count < 2) continue;
+    display.setCursor(18, y);
+    display.print(getRunningStdDev(noiseStats[axis]), 2);
+    display.setCursor(54, y);
+    display.print(getRunningPeakToPeak(noiseStats[axis]));
+    display.setCursor(78, y);
+    display.print(getNoiseEffectiveBits(axis), 1);
+    if (isNoiseWorn(axis)) {
+      display.setCursor(104, y);
+      display.print("WORN");
+    }
+  }
+}
+
+void drawNoiseHistogram(int axis) {
+  const RunningStats& stats = noiseStats[axis];
+  
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print("HIST ");
+  display.print(axisTable[axis].label);
+  display.print(" @");
+  display.print(noiseHistCentre[axis]);
+  
+  display.setCursor(0, 8);
+  display.print("SD:");
+  display.print(getRunningStdDev(stats), 2);
+  display.print(" P-P:");
+  display.print(getRunningPeakToPeak(stats));
+  
+  if (stats.count < NOISE_HIST_WARMUP) {
+    display.setCursor(0, 32);
+    display.print("Collecting...");
+    return;
+  }
+  
+  // 3 px per bin, bars scaled to the fullest bin
+  uint16_t peak = 1;
+  for (int bin = 0; bin < NOISE_HIST_BINS; bin++) {
+    if (noiseHistogram[axis][bin] > peak) peak = noiseHistogram[axis][bin];
+  }
+  
+  const int left = (SCREEN_WIDTH - NOISE_HIST_BINS * 3) / 2;
+  const int bottom = 55;
+  const int maxHeight = 38;
+  for (int bin = 0; bin < NOISE_HIST_BINS; bin++) {
+    int height = (int)((uint32_t)noiseHistogram[axis][bin] * maxHeight / peak);
+    if (noiseHistogram[axis][bin] > 0 && height == 0) height = 1;
+    if (height > 0) {
+      display.fillRect(left + bin * 3, bottom - height + 1, 2, height, SSD1306_WHITE);
+    }
+  }
+  display.drawFastHLine(left, bottom + 1, NOISE_HIST_BINS * 3, SSD1306_WHITE);
+  
+  display.setCursor(0, 57);
+  display.print("-");
+  display.print(NOISE_HIST_HALF_WIDTH);
+  display.setCursor(SCREEN_WIDTH / 2 - 3, 57);
+  display.print("0");
+  display.setCursor(SCREEN_WIDTH - 18, 57);
+  display.print("+");
+  display.print(NOISE_HIST_HALF_WIDTH);
+}
+
 void resetButtonTest() {
   buttonTestActive = false;
   buttonTestPage = 0;
   exitCombinationDetected = false;
-  lastUpArrow = false;
-  lastDownArrow = false;
+  noiseTestActive = false;
 }
 
 bool isButtonTestActive() {
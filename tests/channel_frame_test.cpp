@@ -0,0 +1,151 @@
+/*
+  channel_frame_test.cpp - Host test for channel_frame.h
+  RC Transmitter for Teensy 4.0
+
+  Randomized encode/decode round trip plus the edge cases: channel
+  clamping, the counter high word, negative range fields and payloads
+  that must be rejected. Build and run with "make -C tests".
+*/
+
+#include <stdio.h>
+#include "../channel_frame.h"
+
+#define ROUND_TRIP_FRAMES 100000
+
+int failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      failures++; \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+  } while (0)
+
+// Fixed seed - failures must be reproducible
+uint32_t rngState = 0x12345678;
+
+uint32_t nextRandom() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+int16_t randomRange(int lo, int hi) {
+  return (int16_t)(lo + (int)(nextRandom() % (uint32_t)(hi - lo + 1)));
+}
+
+ChannelFrame randomFrame() {
+  ChannelFrame frame;
+  for (int ch = 0; ch < CHANNEL_FRAME_CHANNELS; ch++) {
+    frame.channels[ch] = randomRange(-1000, 1000);
+  }
+  frame.switches = (uint16_t)nextRandom();
+  frame.counter = nextRandom();
+  frame.throttleMinPWM = (int16_t)nextRandom();
+  frame.throttleMaxPWM = (int16_t)nextRandom();
+  frame.steerMinDegree = (int16_t)nextRandom();
+  frame.steerNeutralDegree = (int16_t)nextRandom();
+  frame.steerMaxDegree = (int16_t)nextRandom();
+  frame.configChanged = (uint8_t)nextRandom();
+  return frame;
+}
+
+bool framesEqual(const ChannelFrame& a, const ChannelFrame& b) {
+  for (int ch = 0; ch < CHANNEL_FRAME_CHANNELS; ch++) {
+    if (a.channels[ch] != b.channels[ch]) return false;
+  }
+  return a.switches == b.switches && a.counter == b.counter &&
+         a.throttleMinPWM == b.throttleMinPWM && a.throttleMaxPWM == b.throttleMaxPWM &&
+         a.steerMinDegree == b.steerMinDegree && a.steerNeutralDegree == b.steerNeutralDegree &&
+         a.steerMaxDegree == b.steerMaxDegree && a.configChanged == b.configChanged;
+}
+
+void testRoundTrip() {
+  int mismatches = 0;
+  for (int i = 0; i < ROUND_TRIP_FRAMES; i++) {
+    ChannelFrame frame = randomFrame();
+    ChannelFrame decoded;
+    uint8_t buffer[CHANNEL_FRAME_SIZE];
+    encodeChannelFrame(frame, buffer);
+    if (!decodeChannelFrame(buffer, sizeof(buffer), decoded) || !framesEqual(frame, decoded)) {
+      mismatches++;
+    }
+  }
+  printf("Round trip: %d frames, %d mismatches\n", ROUND_TRIP_FRAMES, mismatches);
+  CHECK(mismatches == 0);
+}
+
+void testClamping() {
+  ChannelFrame frame = randomFrame();
+  const int16_t inputs[CHANNEL_FRAME_CHANNELS] = {-1000, 1000, -1001, 1001, -32768, 32767, 0, -1};
+  const int16_t expected[CHANNEL_FRAME_CHANNELS] = {-1000, 1000, -1000, 1000, -1000, 1000, 0, -1};
+  memcpy(frame.channels, inputs, sizeof(inputs));
+
+  uint8_t buffer[CHANNEL_FRAME_SIZE];
+  ChannelFrame decoded;
+  encodeChannelFrame(frame, buffer);
+  CHECK(decodeChannelFrame(buffer, sizeof(buffer), decoded));
+  for (int ch = 0; ch < CHANNEL_FRAME_CHANNELS; ch++) {
+    CHECK(decoded.channels[ch] == expected[ch]);
+  }
+}
+
+void testCounterHighWord() {
+  const uint32_t counters[] = {0x0000FFFF, 0x00010000, 0xDEADBEEF, 0xFFFFFFFF};
+  for (uint32_t counter : counters) {
+    ChannelFrame frame = randomFrame();
+    frame.counter = counter;
+
+    uint8_t buffer[CHANNEL_FRAME_SIZE];
+    ChannelFrame decoded;
+    encodeChannelFrame(frame, buffer);
+    CHECK(decodeChannelFrame(buffer, sizeof(buffer), decoded));
+    CHECK(decoded.counter == counter);
+  }
+}
+
+void testNegativeRangeFields() {
+  ChannelFrame frame = randomFrame();
+  frame.throttleMinPWM = -1;
+  frame.throttleMaxPWM = -32768;
+  frame.steerMinDegree = -90;
+  frame.steerNeutralDegree = 0;
+  frame.steerMaxDegree = 32767;
+
+  uint8_t buffer[CHANNEL_FRAME_SIZE];
+  ChannelFrame decoded;
+  encodeChannelFrame(frame, buffer);
+  CHECK(decodeChannelFrame(buffer, sizeof(buffer), decoded));
+  CHECK(decoded.throttleMinPWM == -1);
+  CHECK(decoded.throttleMaxPWM == -32768);
+  CHECK(decoded.steerMinDegree == -90);
+  CHECK(decoded.steerNeutralDegree == 0);
+  CHECK(decoded.steerMaxDegree == 32767);
+}
+
+void testRejectedPayloads() {
+  ChannelFrame frame = randomFrame();
+  uint8_t buffer[CHANNEL_FRAME_SIZE];
+  ChannelFrame decoded;
+  encodeChannelFrame(frame, buffer);
+
+  CHECK(buffer[0] == CHANNEL_FRAME_TYPE);
+  CHECK(!decodeChannelFrame(buffer, CHANNEL_FRAME_SIZE - 1, decoded));
+  CHECK(!decodeChannelFrame(buffer, 0, decoded));
+
+  buffer[0] = CHANNEL_FRAME_TYPE ^ 0x01;
+  CHECK(!decodeChannelFrame(buffer, sizeof(buffer), decoded));
+}
+
+int main() {
+  testRoundTrip();
+  testClamping();
+  testCounterHighWord();
+  testNegativeRangeFields();
+  testRejectedPayloads();
+
+  printf("channel_frame_test: %s\n", failures == 0 ? "PASS" : "FAIL");
+  return failures == 0 ? 0 : 1;
+}
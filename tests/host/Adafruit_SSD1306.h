@@ -0,0 +1,65 @@
+/*
+  Adafruit_SSD1306.h - Host Stub of the Adafruit SSD1306 Driver
+  RC Transmitter for Teensy 4.0
+
+  The driver's page-organised framebuffer (bit 0 of a byte = top row of
+  the page) and its WHITE/BLACK/INVERSE pixel rules. display() only
+  counts frames; there is no panel.
+*/
+
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+ public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire*, int8_t, uint32_t = 400000, uint32_t = 100000)
+      : Adafruit_GFX(w, h) {
+    buffer = new uint8_t[w * ((h + 7) / 8)];
+    clearDisplay();
+  }
+  ~Adafruit_SSD1306() { delete[] buffer; }
+
+  bool begin(uint8_t, uint8_t) {
+    clearDisplay();
+    return true;
+  }
+
+  void clearDisplay() { memset(buffer, 0, _width * ((_height + 7) / 8)); }
+  void display() { displayCalls++; }
+  uint8_t* getBuffer() { return buffer; }
+  void ssd1306_command(uint8_t) {}
+  void dim(bool) {}
+  void invertDisplay(bool) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+    uint8_t* cell = &buffer[x + (y / 8) * _width];
+    uint8_t bit = 1 << (y & 7);
+    switch (color) {
+      case SSD1306_WHITE: *cell |= bit; break;
+      case SSD1306_BLACK: *cell &= ~bit; break;
+      case SSD1306_INVERSE: *cell ^= bit; break;
+    }
+  }
+
+  uint32_t displayCalls = 0;
+
+ private:
+  uint8_t* buffer;
+};
+
+#endif
@@ -0,0 +1,270 @@
+/*
+  Arduino.h - Host Stub of the Teensy 4.0 Arduino Core
+  RC Transmitter for Teensy 4.0
+
+  Just enough of the core for the sketch to build and run on Linux for the
+  host tests. Time only moves when the code calls delay() or the test
+  calls advanceHostTime(), so every run renders the same frames. Analog
+  inputs read hostAnalog[] (mid scale by default), buttons read released
+  and Serial output is discarded unless hostSerialEcho is set.
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <type_traits>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define FALLING 2
+#define RISING 3
+#define CHANGE 4
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+#define PI 3.14159265358979
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define A8 22
+#define A9 23
+
+#define F(x) x
+#define FASTRUN
+#define DMAMEM
+#define PROGMEM
+#define __disable_irq()
+#define __enable_irq()
+#define digitalPinToInterrupt(p) (p)
+
+#define HOST_PINS 64
+
+// Teensy registers read by the sketch
+inline volatile uint32_t TEMPMON_TEMPSENSE0 = 0;
+inline volatile uint32_t GPIO1_PSR = 0xFFFFFFFF, GPIO2_PSR = 0xFFFFFFFF, GPIO3_PSR = 0xFFFFFFFF, GPIO4_PSR = 0xFFFFFFFF;
+inline volatile uint32_t GPIO6_PSR = 0xFFFFFFFF, GPIO7_PSR = 0xFFFFFFFF, GPIO8_PSR = 0xFFFFFFFF, GPIO9_PSR = 0xFFFFFFFF;
+inline volatile uint32_t ARM_DWT_CYCCNT = 0;
+inline uint32_t F_CPU_ACTUAL = 600000000;
+
+// Heap bounds used by freeMemory() - a fixed 64 KB free
+inline unsigned long _heap_end = 0;
+inline char* __brkval = (char*)&_heap_end - 65536;
+
+// Host state the tests may set
+inline uint64_t hostMicros = 0;
+inline int hostAnalog[HOST_PINS];
+inline bool hostAnalogSet = false;
+inline bool hostSerialEcho = false;
+inline uint32_t hostRandom = 1;
+
+inline void advanceHostTime(uint32_t micros) {
+  hostMicros += micros;
+  ARM_DWT_CYCCNT += micros * (F_CPU_ACTUAL / 1000000);
+}
+
+inline unsigned long millis() { return (unsigned long)(hostMicros / 1000); }
+inline unsigned long micros() { return (unsigned long)hostMicros; }
+inline void delay(unsigned long ms) { advanceHostTime(ms * 1000); }
+inline void delayMicroseconds(unsigned int us) { advanceHostTime(us); }
+inline void yield() {}
+
+inline int analogRead(uint8_t pin) {
+  if (!hostAnalogSet) {
+    for (int i = 0; i < HOST_PINS; i++) hostAnalog[i] = 512;
+    hostAnalogSet = true;
+  }
+  return pin < HOST_PINS ? hostAnalog[pin] : 0;
+}
+
+inline int digitalRead(uint8_t) { return HIGH; }  // Pull-ups, nothing pressed
+inline uint8_t digitalReadFast(uint8_t) { return HIGH; }
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void analogWrite(uint8_t, int) {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void tone(uint8_t, unsigned int) {}
+inline void tone(uint8_t, unsigned int, unsigned long) {}
+inline void noTone(uint8_t) {}
+inline void analogReadResolution(unsigned int) {}
+inline void analogReadAveraging(unsigned int) {}
+inline void attachInterrupt(uint8_t, void (*)(void), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+inline volatile uint32_t* portInputRegister(uint8_t) { return &GPIO6_PSR; }
+inline uint32_t digitalPinToBitMask(uint8_t pin) { return 1u << (pin & 31); }
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  if (inMax == inMin) return outMin;
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Deterministic - the display test's random pixels are the same every run
+inline long random(long howBig) {
+  if (howBig <= 0) return 0;
+  hostRandom = hostRandom * 1103515245u + 12345u;
+  return (long)((hostRandom >> 16) % (uint32_t)howBig);
+}
+inline long random(long howSmall, long howBig) {
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+template<class A, class B> auto min(A a, B b) -> typename std::common_type<A, B>::type { return a < b ? a : b; }
+template<class A, class B> auto max(A a, B b) -> typename std::common_type<A, B>::type { return a > b ? a : b; }
+template<class A, class L, class H> A constrain(A x, L low, H high) { return x < low ? low : (x > high ? high : x); }
+using std::abs;
+
+class String {
+ public:
+  String() {}
+  String(const char* text) : text(text ? text : "") {}
+  String(const std::string& text) : text(text) {}
+  String(char c) : text(1, c) {}
+  String(int value) : text(std::to_string(value)) {}
+  String(unsigned value) : text(std::to_string(value)) {}
+  String(long value) : text(std::to_string(value)) {}
+  String(unsigned long value) : text(std::to_string(value)) {}
+  String(float value, int digits = 2) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    text = buffer;
+  }
+
+  unsigned length() const { return text.size(); }
+  const char* c_str() const { return text.c_str(); }
+  char& operator[](unsigned i) { return text[i]; }
+  char operator[](unsigned i) const { return text[i]; }
+  char charAt(unsigned i) const { return i < text.size() ? text[i] : 0; }
+  void remove(unsigned index, unsigned count) { if (index < text.size()) text.erase(index, count); }
+  void toCharArray(char* buffer, unsigned size) const {
+    if (!size) return;
+    strncpy(buffer, text.c_str(), size);
+    buffer[size - 1] = '\0';
+  }
+  int indexOf(char c) const { size_t pos = text.find(c); return pos == std::string::npos ? -1 : (int)pos; }
+  String substring(unsigned from) const { return from < text.size() ? String(text.substr(from)) : String(); }
+  String substring(unsigned from, unsigned to) const {
+    return from < text.size() && to > from ? String(text.substr(from, to - from)) : String();
+  }
+
+  String& operator+=(const String& other) { text += other.text; return *this; }
+  String& operator+=(const char* other) { text += other; return *this; }
+  String& operator+=(char c) { text += c; return *this; }
+  bool operator==(const String& other) const { return text == other.text; }
+  bool operator==(const char* other) const { return text == other; }
+  bool operator!=(const String& other) const { return text != other.text; }
+  bool operator!=(const char* other) const { return text != other; }
+
+  std::string text;
+};
+
+inline String operator+(const String& a, const String& b) { return String(a.text + b.text); }
+inline String operator+(const String& a, const char* b) { return String(a.text + b); }
+inline String operator+(const char* a, const String& b) { return String(a + b.text); }
+inline String operator+(const String& a, char b) { return String(a.text + b); }
+
+// Arduino Print - number formatting follows the core
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+  size_t print(const char* text) { return write(text); }
+  size_t print(const String& text) { return write(text.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC) {
+    if (base == DEC && value < 0) return write('-') + printNumber(0ul - (unsigned long)value, DEC);
+    return printNumber((unsigned long)value, base);
+  }
+  size_t print(unsigned long value, int base = DEC) { return printNumber(value, base); }
+  size_t print(double value, int digits = 2) { return printFloat(value, digits); }
+
+  size_t println() { return write("\r\n"); }
+  template<class T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template<class T> size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+ private:
+  size_t printNumber(unsigned long value, int base) {
+    char buffer[8 * sizeof(long) + 1];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = '\0';
+    if (base < 2) base = 10;
+    do {
+      int digit = value % base;
+      *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+      value /= base;
+    } while (value);
+    return write(p);
+  }
+
+  size_t printFloat(double value, int digits) {
+    if (isnan(value)) return write("nan");
+    if (isinf(value)) return write("inf");
+    size_t n = 0;
+    if (value < 0) {
+      n += write('-');
+      value = -value;
+    }
+    double rounding = 0.5;
+    for (int i = 0; i < digits; i++) rounding /= 10.0;
+    value += rounding;
+
+    unsigned long whole = (unsigned long)value;
+    double remainder = value - (double)whole;
+    n += printNumber(whole, DEC);
+    if (digits > 0) n += write('.');
+    while (digits-- > 0) {
+      remainder *= 10.0;
+      int digit = (int)remainder;
+      n += write((uint8_t)('0' + digit));
+      remainder -= digit;
+    }
+    return n;
+  }
+};
+
+class HostSerial : public Print {
+ public:
+  void begin(long) {}
+  operator bool() { return true; }
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(uint8_t c) override {
+    if (hostSerialEcho) fputc(c, stdout);
+    return 1;
+  }
+  using Print::write;
+};
+
+inline HostSerial Serial;
+
+#endif
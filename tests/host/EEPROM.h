@@ -0,0 +1,42 @@
+/*
+  EEPROM.h - Host Stub of the Teensy EEPROM Library
+  RC Transmitter for Teensy 4.0
+
+  1080 bytes in RAM, erased (0xFF) at start - every module loads its
+  defaults, as on a new board.
+*/
+
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include <Arduino.h>
+
+#define HOST_EEPROM_SIZE 1080
+
+class EEPROMClass {
+ public:
+  EEPROMClass() { memset(data, 0xFF, sizeof(data)); }
+
+  uint8_t read(int address) { return inRange(address, 1) ? data[address] : 0xFF; }
+  void write(int address, uint8_t value) { if (inRange(address, 1)) data[address] = value; }
+  void update(int address, uint8_t value) { write(address, value); }
+  int length() { return HOST_EEPROM_SIZE; }
+
+  template<class T> T& get(int address, T& value) {
+    if (inRange(address, sizeof(T))) memcpy((void*)&value, data + address, sizeof(T));
+    return value;
+  }
+  template<class T> const T& put(int address, const T& value) {
+    if (inRange(address, sizeof(T))) memcpy(data + address, (const void*)&value, sizeof(T));
+    return value;
+  }
+
+  uint8_t data[HOST_EEPROM_SIZE];
+
+ private:
+  bool inRange(int address, size_t size) { return address >= 0 && address + size <= HOST_EEPROM_SIZE; }
+};
+
+inline EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,19 @@
+/*
+  SPI.h - Host Stub of the SPI Library
+  RC Transmitter for Teensy 4.0
+*/
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+class SPIClass {
+ public:
+  void begin() {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
+
+inline SPIClass SPI;
+
+#endif
@@ -0,0 +1,15 @@
+/*
+  nRF24L01.h - Host Stub of the nRF24L01 Register Map
+  RC Transmitter for Teensy 4.0
+*/
+
+#ifndef HOST_NRF24L01_H
+#define HOST_NRF24L01_H
+
+#define CONFIG 0x00
+#define EN_AA 0x01
+#define EN_RXADDR 0x02
+#define RF_CH 0x05
+#define RF_SETUP 0x06
+
+#endif
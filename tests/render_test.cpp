@@ -0,0 +1,278 @@
+/*
+  render_test.cpp - Host Render and Golden-Image Test of Every Screen
+  RC Transmitter for Teensy 4.0
+
+  Builds the whole sketch against the stub core in host/ (time only moves
+  on delay(), sticks at mid scale, EEPROM erased) and renders every
+  screen: the main screen, each list menu and dialog, every settings
+  editor, calibration, cancel confirmation, the radio/display/input tests
+  and the factory reset progress. Each framebuffer is compared with
+  golden/<name>.pbm - the same P1 layout the on-device dump
+  (display_dump.h) prints. Mismatches are written to out/<name>.pbm.
+  Each screen is then rendered BENCH_ROUNDS more times and the mean host
+  render time is reported.
+
+  make -C tests           build and run all host tests
+  make -C tests golden    rewrite golden/ after an intended UI change
+*/
+
+void printSystemStatus();  // Prototype the Arduino builder would generate
+#include "../Transmitter_Code.ino"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR "golden/"
+#endif
+#define OUTPUT_DIR "out/"
+#define BENCH_ROUNDS 200
+
+enum ScreenKind {
+  SCREEN_MAIN = 0,
+  SCREEN_LIST,            // List menu or dialog - drawn straight from its node
+  SCREEN_EDITOR,          // Settings editor, opened with startSetting()
+  SCREEN_HOOK,            // Opened through the node's enter hook (tests, factory reset)
+  SCREEN_CANCEL_CONFIRM,
+  SCREEN_CAL_STICK,
+  SCREEN_CAL_POT,
+  SCREEN_CAL_SWEEP
+};
+
+struct HostScreen {
+  std::string name;       // File name in golden/
+  ScreenKind kind;
+  int state;              // MenuState for list, editor and hook screens
+};
+
+// Function declarations
+std::vector<HostScreen> collectScreens();
+std::string getScreenName(int state);
+std::string slugify(const char* text);
+void openScreen(const HostScreen& screen);
+void renderScreen(const HostScreen& screen);
+void closeScreen(const HostScreen& screen);
+std::string framebufferToPBM();
+bool readFile(const std::string& path, std::string& contents);
+bool writeFile(const std::string& path, const std::string& contents);
+int countPixelDifferences(const std::string& a, const std::string& b);
+
+// Lists and editors first, then the screens that change state on entry - factory reset last
+std::vector<HostScreen> collectScreens() {
+  std::vector<HostScreen> screens;
+  screens.push_back({"main", SCREEN_MAIN, MENU_HIDDEN});
+
+  for (int state = MENU_MAIN; state < MENU_STATE_COUNT; state++) {
+    const MenuNode& node = getMenuNode(state);
+    if (node.items && !node.enter) screens.push_back({"menu_" + getScreenName(state), SCREEN_LIST, state});
+  }
+  for (int state = MENU_MAIN; state < MENU_STATE_COUNT; state++) {
+    const MenuNode& node = getMenuNode(state);
+    if (!node.items && node.header && !node.enter) screens.push_back({"edit_" + getScreenName(state), SCREEN_EDITOR, state});
+  }
+
+  screens.push_back({"cancel_confirm", SCREEN_CANCEL_CONFIRM, MENU_CANCEL_CONFIRM});
+  screens.push_back({"calibration_stick", SCREEN_CAL_STICK, MENU_CAL_IN_PROGRESS});
+  screens.push_back({"calibration_pot", SCREEN_CAL_POT, MENU_CAL_IN_PROGRESS});
+  screens.push_back({"calibration_sweep", SCREEN_CAL_SWEEP, MENU_CAL_IN_PROGRESS});
+
+  const int hookScreens[] = {MENU_RADIO_TEST, MENU_DISPLAY_TEST, MENU_BUTTON_TEST, MENU_FACTORY_RESET_PROGRESS};
+  for (int state : hookScreens) {
+    screens.push_back({getScreenName(state), SCREEN_HOOK, state});
+  }
+  return screens;
+}
+
+std::string getScreenName(int state) {
+  switch (state) {
+    case MENU_CURVE_CHANNEL: return "curve_channel";
+    case MENU_FACTORY_RESET_CONFIRM: return "factory_reset_confirm";
+    case MENU_FACTORY_RESET_FINAL: return "factory_reset_final";
+    case MENU_FACTORY_RESET_PROGRESS: return "factory_reset";
+    case MENU_RADIO_TEST: return "radio_test";
+    case MENU_DISPLAY_TEST: return "display_test";
+    case MENU_BUTTON_TEST: return "button_test";
+    default: return slugify(getMenuNode(state).header);
+  }
+}
+
+// "Curves & Rates" -> "curves_rates"
+std::string slugify(const char* text) {
+  std::string slug;
+  for (const char* p = text; p && *p; p++) {
+    char c = *p;
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+    if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) slug += c;
+    else if (!slug.empty() && slug.back() != '_') slug += '_';
+  }
+  while (!slug.empty() && slug.back() == '_') slug.pop_back();
+  return slug;
+}
+
+void openScreen(const HostScreen& screen) {
+  finishDisplayFlush();
+  switch (screen.kind) {
+    case SCREEN_MAIN:
+      setCurrentMenu(MENU_HIDDEN);
+      readJoysticks();  // One TX tick - the RAW column shows the last tick's readings
+      break;
+    case SCREEN_LIST:
+      setCurrentMenu(screen.state);
+      break;
+    case SCREEN_EDITOR:
+      setCurrentMenu(getMenuNode(screen.state).parent);
+      startSetting(screen.state);
+      break;
+    case SCREEN_HOOK:
+      setCurrentMenu(getMenuNode(screen.state).parent);
+      openMenuNode(screen.state);
+      break;
+    case SCREEN_CANCEL_CONFIRM:
+      setCurrentMenu(MENU_MAIN);
+      showCancelConfirm();
+      break;
+    case SCREEN_CAL_STICK:
+      startAxisCalibration(AXIS_RIGHT_X);
+      break;
+    case SCREEN_CAL_POT:
+      startAxisCalibration(AXIS_LEFT_POT);
+      break;
+    case SCREEN_CAL_SWEEP:
+      startSweepCalibration();
+      break;
+  }
+}
+
+// One frame into the framebuffer, the way loop() would draw it
+void renderScreen(const HostScreen& screen) {
+  if (screen.kind == SCREEN_MAIN) {
+    mainModelValid = false;  // Never skipped as unchanged
+    updateDisplay();
+    while (mainRenderStage != RENDER_IDLE) {
+      renderMainDisplaySlice();
+    }
+  } else {
+    drawMenu();
+  }
+}
+
+void closeScreen(const HostScreen& screen) {
+  switch (screen.kind) {
+    case SCREEN_EDITOR:
+      cancelSetting();
+      break;
+    case SCREEN_HOOK:
+      if (getMenuNode(screen.state).leave) getMenuNode(screen.state).leave();
+      factoryResetActive = false;
+      break;
+    case SCREEN_CANCEL_CONFIRM:
+      cancelConfirmActive = false;
+      break;
+    case SCREEN_CAL_STICK:
+    case SCREEN_CAL_POT:
+    case SCREEN_CAL_SWEEP:
+      exitMenuCalibration();
+      break;
+    default:
+      break;
+  }
+  setCurrentMenu(MENU_HIDDEN);
+  finishDisplayFlush();
+}
+
+// Same layout as printScreenDump(): P1, two 64 pixel lines per row, 1 = unlit
+std::string framebufferToPBM() {
+  const uint8_t* buffer = display.getBuffer();
+  std::string pbm = "P1\n" + std::to_string(SCREEN_WIDTH) + " " + std::to_string(SCREEN_HEIGHT) + "\n";
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    const uint8_t* row = buffer + (y / 8) * SCREEN_WIDTH;
+    uint8_t bit = 1 << (y & 7);
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      pbm += (row[x] & bit) ? '0' : '1';
+      if (x % (SCREEN_WIDTH / 2) == SCREEN_WIDTH / 2 - 1) pbm += '\n';
+    }
+  }
+  return pbm;
+}
+
+bool readFile(const std::string& path, std::string& contents) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) return false;
+  contents.clear();
+  char chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) contents.append(chunk, n);
+  fclose(file);
+  return true;
+}
+
+bool writeFile(const std::string& path, const std::string& contents) {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) return false;
+  bool ok = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+  fclose(file);
+  return ok;
+}
+
+// Pixels that differ between two PBMs of the same layout
+int countPixelDifferences(const std::string& a, const std::string& b) {
+  if (a.size() != b.size()) return SCREEN_WIDTH * SCREEN_HEIGHT;
+  int differences = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i] != b[i]) differences++;
+  }
+  return differences;
+}
+
+int main(int argc, char** argv) {
+  bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+
+  setup();
+
+  std::vector<HostScreen> screens = collectScreens();
+  int failures = 0;
+
+  printf("%-28s %-8s %10s  %s\n", "Screen", "CRC32", "Render us", "Golden");
+  for (const HostScreen& screen : screens) {
+    openScreen(screen);
+    renderScreen(screen);
+    std::string actual = framebufferToPBM();
+    uint32_t crc = crc32Framebuffer();
+
+    // Host render time - relative cost between screens, not Teensy microseconds
+    double totalMicros = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+      finishDisplayFlush();
+      auto start = std::chrono::steady_clock::now();
+      renderScreen(screen);
+      totalMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+    closeScreen(screen);
+
+    std::string goldenPath = std::string(GOLDEN_DIR) + screen.name + ".pbm";
+    std::string golden;
+    const char* result;
+    if (update) {
+      result = writeFile(goldenPath, actual) ? "updated" : "WRITE FAILED";
+    } else if (!readFile(goldenPath, golden)) {
+      result = "MISSING (make golden)";
+      failures++;
+    } else if (golden != actual) {
+      static char text[64];
+      snprintf(text, sizeof(text), "MISMATCH (%d pixels)", countPixelDifferences(golden, actual));
+      result = text;
+      writeFile(std::string(OUTPUT_DIR) + screen.name + ".pbm", actual);
+      failures++;
+    } else {
+      result = "ok";
+    }
+
+    printf("%-28s %08X %10.2f  %s\n", screen.name.c_str(), crc, totalMicros / BENCH_ROUNDS, result);
+  }
+
+  printf("render_test: %d screens, %s\n", (int)screens.size(),
+         update ? "golden images updated" : failures == 0 ? "PASS" : "FAIL");
+  if (failures) printf("Actual frames of the failing screens are in " OUTPUT_DIR "\n");
+  return failures == 0 ? 0 : 1;
+}
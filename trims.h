@@ -0,0 +1,241 @@
+/*
+  trims.h - Digital Trims with Per-Model EEPROM Storage
+  RC Transmitter for Teensy 4.0
+
+  Trims are stored in steps and added to the shaped stick value as a fixed
+  offset of TRIM_STEP_UNITS per step. Each radio address (one per boat)
+  has its own trim slot, so switching models brings its trims back.
+  Changes are written back lazily: once the trims have been idle for
+  TRIM_SAVE_DELAY_MS, one EEPROM byte is updated per loop() pass, so
+  trimming never stalls the loop on a flash write.
+*/
+
+#ifndef TRIMS_H
+#define TRIMS_H
+
+#include <EEPROM.h>
+#include "config.h"
+#include "audio.h"
+
+// EEPROM layout: ... mixer at 256, trims at 448, settings at 512
+#define EEPROM_TRIM_ADDRESS 448
+#define TRIM_SIGNATURE 0x7219
+
+#define TRIM_MODEL_SLOTS 4
+#define TRIM_MAX_STEPS 50           // +-50 steps
+#define TRIM_STEP_UNITS 5           // 5/1000 of full travel per step (max +-25%)
+#define TRIM_SAVE_DELAY_MS 2000     // Idle time before the deferred write starts
+
+enum TrimChannel {
+  TRIM_STEERING = 0,
+  TRIM_THROTTLE,
+  NUM_TRIM_CHANNELS
+};
+
+// One model = one radio address
+struct TrimModel {
+  char address[6];                    // Radio address this slot belongs to ("" = free)
+  int8_t trim[NUM_TRIM_CHANNELS];     // Steps, -TRIM_MAX_STEPS to +TRIM_MAX_STEPS
+};
+
+// Trim data stored in EEPROM
+struct TrimData {
+  TrimModel models[TRIM_MODEL_SLOTS];
+  uint8_t nextSlot;                   // Slot reused when a new address has no free slot
+
+  // EEPROM signature
+  uint16_t signature;
+};
+
+TrimData trimData;
+int trimSlot = 0;                     // Slot of the current model
+int16_t trimOffset[NUM_TRIM_CHANNELS];  // Compiled offsets (-1000..+1000 units)
+
+// Deferred write state
+bool trimDirty = false;
+unsigned long trimChangeTime = 0;
+int trimWriteIndex = -1;              // Next byte to update, -1 = idle
+bool trimDetentLatched = false;       // Auto-repeat stops at centre until the trigger is pressed again
+
+// Function declarations
+void initTrims(const char* radioAddress);
+void loadTrims();
+void resetTrims();
+void saveTrimsNow();
+void selectTrimModel(const char* radioAddress);
+void compileTrims();
+bool stepTrim(int channel, int direction, bool repeat);
+int applyTrim(int channel, int value);
+int getTrim(int channel);
+void updateTrims();
+void playTrimStepSound();
+void playTrimCentreSound();
+void playTrimLimitSound();
+
+// Trim sounds - short enough not to mask the next repeat
+const AudioNote trimStepSequence[] = {
+  {NOTE_C6, 12}
+};
+
+const AudioNote trimCentreSequence[] = {
+  {NOTE_G5, 40}, {REST, 30}, {NOTE_G5, 40}
+};
+
+const AudioNote trimLimitSequence[] = {
+  {NOTE_C4, 80}
+};
+
+void initTrims(const char* radioAddress) {
+  loadTrims();
+  selectTrimModel(radioAddress);
+}
+
+void loadTrims() {
+  EEPROM.get(EEPROM_TRIM_ADDRESS, trimData);
+
+  if (trimData.signature != TRIM_SIGNATURE || trimData.nextSlot >= TRIM_MODEL_SLOTS) {
+    Serial.println("No valid trims found, using defaults");
+    resetTrims();
+  } else {
+    Serial.println("Trims loaded from EEPROM");
+  }
+  trimDirty = false;
+  trimWriteIndex = -1;
+}
+
+void resetTrims() {
+  memset(&trimData, 0, sizeof(trimData));
+  trimData.signature = TRIM_SIGNATURE;
+  trimSlot = 0;
+  compileTrims();
+}
+
+// Blocking write - only for factory reset and "reset all"
+void saveTrimsNow() {
+  trimData.signature = TRIM_SIGNATURE;
+  EEPROM.put(EEPROM_TRIM_ADDRESS, trimData);
+  trimDirty = false;
+  trimWriteIndex = -1;
+  Serial.println("Trims saved to EEPROM");
+}
+
+// Find (or claim) the slot for a radio address
+void selectTrimModel(const char* radioAddress) {
+  int slot = -1;
+  for (int i = 0; i < TRIM_MODEL_SLOTS && slot < 0; i++) {
+    if (strncmp(trimData.models[i].address, radioAddress, 5) == 0) slot = i;
+  }
+  for (int i = 0; i < TRIM_MODEL_SLOTS && slot < 0; i++) {
+    if (trimData.models[i].address[0] == '\0') slot = i;
+  }
+  if (slot < 0) {
+    slot = trimData.nextSlot;
+    trimData.nextSlot = (trimData.nextSlot + 1) % TRIM_MODEL_SLOTS;
+  }
+
+  TrimModel& model = trimData.models[slot];
+  if (strncmp(model.address, radioAddress, 5) != 0) {
+    // New model in this slot - start centred
+    strncpy(model.address, radioAddress, 5);
+    model.address[5] = '\0';
+    memset(model.trim, 0, sizeof(model.trim));
+    trimDirty = true;
+    trimChangeTime = millis();
+  }
+
+  trimSlot = slot;
+  compileTrims();
+
+  Serial.print("Trim model ");
+  Serial.print(model.address);
+  Serial.print(" (slot ");
+  Serial.print(slot);
+  Serial.print("): steering ");
+  Serial.print(model.trim[TRIM_STEERING]);
+  Serial.print(", throttle ");
+  Serial.println(model.trim[TRIM_THROTTLE]);
+}
+
+void compileTrims() {
+  for (int ch = 0; ch < NUM_TRIM_CHANNELS; ch++) {
+    trimOffset[ch] = trimData.models[trimSlot].trim[ch] * TRIM_STEP_UNITS;
+  }
+}
+
+// One trim step; returns false if the trim did not move
+bool stepTrim(int channel, int direction, bool repeat) {
+  if (!repeat) trimDetentLatched = false;
+  if (repeat && trimDetentLatched) return false;
+
+  int8_t& trim = trimData.models[trimSlot].trim[channel];
+  int value = trim + direction;
+  if (value > TRIM_MAX_STEPS || value < -TRIM_MAX_STEPS) {
+    if (!repeat) playTrimLimitSound();
+    return false;
+  }
+
+  trim = value;
+  compileTrims();
+
+  // Centre detent - distinct sound and the auto-repeat stops here
+  if (value == 0) {
+    trimDetentLatched = true;
+    playTrimCentreSound();
+  } else {
+    playTrimStepSound();
+  }
+
+  trimDirty = true;
+  trimChangeTime = millis();
+  trimWriteIndex = -1;  // Restart the deferred write after the next idle period
+
+  Serial.print(channel == TRIM_STEERING ? "Steering trim: " : "Throttle trim: ");
+  Serial.println(value);
+  return true;
+}
+
+int applyTrim(int channel, int value) {
+  return constrain(value + trimOffset[channel], -1000, 1000);
+}
+
+int getTrim(int channel) {
+  return trimData.models[trimSlot].trim[channel];
+}
+
+// Deferred EEPROM write - at most one byte per call
+void updateTrims() {
+  if (!trimDirty) return;
+
+  if (trimWriteIndex < 0) {
+    if (millis() - trimChangeTime < TRIM_SAVE_DELAY_MS) return;
+    trimData.signature = TRIM_SIGNATURE;
+    trimWriteIndex = 0;
+  }
+
+  const uint8_t* bytes = (const uint8_t*)&trimData;
+  EEPROM.update(EEPROM_TRIM_ADDRESS + trimWriteIndex, bytes[trimWriteIndex]);
+  trimWriteIndex++;
+
+  if (trimWriteIndex >= (int)sizeof(trimData)) {
+    trimDirty = false;
+    trimWriteIndex = -1;
+    Serial.println("Trims saved to EEPROM");
+  }
+}
+
+void playTrimStepSound() {
+  if (!audioSettings.systemSounds || !audioSettings.enabled) return;
+  playAudioSequence(trimStepSequence, sizeof(trimStepSequence) / sizeof(AudioNote));
+}
+
+void playTrimCentreSound() {
+  if (!audioSettings.systemSounds || !audioSettings.enabled) return;
+  playAudioSequence(trimCentreSequence, sizeof(trimCentreSequence) / sizeof(AudioNote));
+}
+
+void playTrimLimitSound() {
+  if (!audioSettings.systemSounds || !audioSettings.enabled) return;
+  playAudioSequence(trimLimitSequence, sizeof(trimLimitSequence) / sizeof(AudioNote));
+}
+
+#endif